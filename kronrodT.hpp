@@ -1,8 +1,16 @@
+#pragma once
+
 #include <vector>
+#include <memory_resource>
+#include <span>
 #include <tuple>
+#include <atomic>
+#include <thread>
 #include <iostream>
 #include <limits>
 
+#include "kronrod_scalarT.hpp"
+
 // // void kronrod_adjust ( FloatingPoint a, FloatingPoint b, int n, FloatingPoint x[], FloatingPoint w1[], FloatingPoint w2[] );
 
 template <typename FloatingPoint>
@@ -39,13 +47,428 @@ FloatingPoint r8_epsilon ( )
 //    Output, FloatingPoint R8_EPSILON, the R8 round-off unit.
 //
 {
-  static FloatingPoint value = std::numeric_limits<FloatingPoint>::epsilon();
+  static FloatingPoint value = kronrod_scalar<FloatingPoint>::epsilon ( );
 
   return value;
 }
 
 template <typename FloatingPoint>
-std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps, const FloatingPoint& coef2, const bool& even, const std::vector<FloatingPoint>& b, FloatingPoint x)
+FloatingPoint kronrod_eps ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_EPS returns the default relative tolerance for the abscissas.
+//
+//  Discussion:
+//
+//    The default asks for the abscissas to working precision, which is
+//    given by std::numeric_limits<FloatingPoint>::digits.  This does not
+//    cost extra iterations, because KRONROD_NEWTON_TEST stops the Newton
+//    iteration as soon as quadratic convergence guarantees that accuracy.
+//
+//    A larger tolerance is only worth passing when less accurate rules
+//    are acceptable.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Output, FloatingPoint KRONROD_EPS, the default tolerance.
+//
+{
+  return r8_epsilon<FloatingPoint> ( );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+int kronrod_newton_test ( const FloatingPoint& eps, const FloatingPoint& x, 
+  const FloatingPoint& delta, FloatingPoint& delta_old )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_NEWTON_TEST decides whether a Newton iteration may stop.
+//
+//  Discussion:
+//
+//    All tests are relative to the abscissa X, which has just been
+//    corrected by DELTA.
+//
+//    The weights depend on the derivative at the abscissa, so the last
+//    step must be taken from an abscissa that is already accurate.  The
+//    iteration stops at once only if DELTA is at the roundoff level, or
+//    if the corrections have stopped decreasing near convergence, which
+//    means that rounding errors in the polynomial values dominate.
+//
+//    Otherwise one more step is taken if DELTA is below EPS, or if the
+//    iteration is in its quadratic phase and the next correction, about
+//    DELTA^3 / DELTA_OLD^2, is predicted to be at the roundoff level.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, FloatingPoint EPS, the requested relative accuracy.
+//
+//    Input, FloatingPoint X, the corrected abscissa.
+//
+//    Input, FloatingPoint DELTA, the last Newton correction.
+//
+//    Input/output, FloatingPoint &DELTA_OLD, |DELTA| from the previous 
+//    step, or zero on the first step.  On output, |DELTA|.
+//
+//    Output, int KRONROD_NEWTON_TEST, 0 if the iteration should continue,
+//    1 if one more step should be taken, and 2 if it may stop now.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint ad = scalar::abs ( delta );
+  FloatingPoint ax = scalar::abs ( x );
+  FloatingPoint roundoff = r8_epsilon<FloatingPoint> ( ) * ax;
+  int value = 0;
+
+  if ( ad <= roundoff )
+  {
+    value = 2;
+  }
+  else if ( delta_old != FloatingPoint ( 0 ) && delta_old <= ad 
+    && delta_old <= scalar::sqrt ( r8_epsilon<FloatingPoint> ( ) ) * ax )
+  {
+    value = 2;
+  }
+  else if ( ad <= eps * ax )
+  {
+    value = 1;
+  }
+  else if ( delta_old != FloatingPoint ( 0 ) && ad < delta_old )
+  {
+    FloatingPoint ratio = ad / delta_old;
+    if ( ad * ratio * ratio <= roundoff )
+    {
+      value = 1;
+    }
+  }
+
+  delta_old = ad;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename Function>
+void kronrod_parallel_for ( int n, int threads, Function fn )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_PARALLEL_FOR calls FN(I) for I = 0 to N-1 on several threads.
+//
+//  Discussion:
+//
+//    The indices are handed out one at a time, so that threads that get
+//    cheap items take more of them.  With THREADS <= 1 the loop runs on
+//    the calling thread, in order, and starts no threads.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the number of items.
+//
+//    Input, int THREADS, the number of threads to use, including the
+//    calling thread.
+//
+//    Input, Function FN, called once with each index.  Calls for different
+//    indices must be safe to run at the same time.
+//
+{
+  if ( threads <= 1 || n <= 1 )
+  {
+    for ( int i = 0; i < n; i++ )
+    {
+      fn ( i );
+    }
+    return;
+  }
+
+  std::atomic<int> next ( 0 );
+  auto worker = [&] ( )
+  {
+    for ( int i = next++; i < n; i = next++ )
+    {
+      fn ( i );
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for ( int t = 1; t < threads && t < n; t++ )
+  {
+    pool.push_back ( std::thread ( worker ) );
+  }
+  worker ( );
+  for ( std::thread& t : pool )
+  {
+    t.join ( );
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_stieltjes (int N, const bool& even, std::span<const FloatingPoint> b, const FloatingPoint& x, FloatingPoint& f, FloatingPoint& fd)
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_STIELTJES evaluates the polynomial whose roots are the Kronrod
+//    abscissas, and its derivative.
+//
+//  Discussion:
+//
+//    The polynomial is summed from its Chebyshev coefficients B by the
+//    Clenshaw recurrence.  This is the evaluation step of ABWE1.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Maria Branders.
+//    Original C++ version by John Burkardt.
+//    Modern C++ version by Okwuchukwu Nwobi.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, bool EVEN, is TRUE if N is even.
+//
+//    Input, FloatingPoint B[M+1], the Chebyshev coefficients.
+//
+//    Input, FloatingPoint X, the point of evaluation.
+//
+//    Output, FloatingPoint &F, &FD, the polynomial and its derivative.
+//
+{
+  FloatingPoint ai;
+  FloatingPoint b0;
+  FloatingPoint b1;
+  FloatingPoint b2;
+  FloatingPoint d0;
+  FloatingPoint d1;
+  FloatingPoint d2;
+  FloatingPoint dif;
+  FloatingPoint yy;
+
+  int M = ( N + 1 ) / 2;
+  int i;
+  int k;
+
+  b0 = FloatingPoint ( 0 );
+  b1 = FloatingPoint ( 0 );
+  b2 = b[M];
+  yy = FloatingPoint ( 4 ) * (x) * (x) - FloatingPoint ( 2 );
+  d1 = FloatingPoint ( 0 );
+
+  if ( even )
+  {
+    ai = M + M + 1;
+    d2 = ai * b[M];
+    dif = FloatingPoint ( 2 );
+  }
+  else
+  {
+    ai = M + 1;
+    d2 = FloatingPoint ( 0 );
+    dif = FloatingPoint ( 1 );
+  }
+
+  for ( k = 1; k <= M; k++ )
+  {
+    ai = ai - dif;
+    i = M - k + 1;
+    b0 = b1;
+    b1 = b2;
+    d0 = d1;
+    d1 = d2;
+    b2 = yy * b1 - b0 + b[i-1];
+    if ( !even )
+    {
+      i = i + 1;
+    }
+    d2 = yy * d1 - d0 + ai * b[i-1];
+  }
+
+  if ( even )
+  {
+    f = ( x ) * ( b2 - b1 );
+    fd = d2 + d1;
+  }
+  else
+  {
+    f = ( b2 - b0 ) / FloatingPoint ( 2 );
+    fd = FloatingPoint ( 4 ) * ( x ) * d2;
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_legendre (int N, const FloatingPoint& x, FloatingPoint& p, FloatingPoint& pd, FloatingPoint& pm1)
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_LEGENDRE evaluates the Legendre polynomial of degree N and
+//    its derivative.
+//
+//  Discussion:
+//
+//    This is the evaluation step of ABWE2.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Maria Branders.
+//    Original C++ version by John Burkardt.
+//    Modern C++ version by Okwuchukwu Nwobi.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, FloatingPoint X, the point of evaluation.
+//
+//    Output, FloatingPoint &P, &PD, the values of P(N,X) and P'(N,X).
+//
+//    Output, FloatingPoint &PM1, the value of P(N-1,X).
+//
+{
+  FloatingPoint ai;
+  FloatingPoint p0;
+  FloatingPoint p1;
+  FloatingPoint p2;
+  FloatingPoint pd0;
+  FloatingPoint pd1;
+  FloatingPoint pd2;
+
+  int k;
+
+  p0 = FloatingPoint ( 1 );
+  p1 = x;
+  pd0 = FloatingPoint ( 0 );
+  pd1 = FloatingPoint ( 1 );
+//
+//  When N is 1, the recurrence below is empty, and P(1,X) = X.
+//
+  p2 = x;
+  pd2 = FloatingPoint ( 1 );
+
+  ai = FloatingPoint ( 0 );
+  for ( k = 2; k <= N; k++ )
+  {
+    ai = ai + FloatingPoint ( 1 );
+    p2 = ( ( ai + ai + FloatingPoint ( 1 ) ) * (x) * p1 - ai * p0 ) / ( ai + FloatingPoint ( 1 ) );
+    pd2 = ( ( ai + ai + FloatingPoint ( 1 ) ) * ( p1 + (x) * pd1 ) - ai * pd0 ) 
+      / ( ai + FloatingPoint ( 1 ) );
+    p0 = p1;
+    p1 = p2;
+    pd0 = pd1;
+    pd1 = pd2;
+  }
+
+  p = p2;
+  pd = pd2;
+  pm1 = p0;
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_gauss_bracket (int N, int j, FloatingPoint& lo, FloatingPoint& hi)
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_GAUSS_BRACKET returns an interval containing one Gauss abscissa.
+//
+//  Discussion:
+//
+//    If the Gauss abscissas, in decreasing order, are cos(THETA(J)), then
+//
+//      ( J - 1/2 ) * PI / ( N + 1/2 ) < THETA(J) < J * PI / ( N + 1 ).
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Gabor Szego,
+//    Orthogonal Polynomials,
+//    American Mathematical Society, 1975,
+//    Theorem 6.21.2.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, int J, the index of the abscissa, counting from 1 at the
+//    right end.
+//
+//    Output, FloatingPoint &LO, &HI, the ends of the interval.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint pi = scalar::pi ( );
+
+  lo = scalar::cos ( FloatingPoint ( j ) * pi / FloatingPoint ( N + 1 ) );
+  hi = scalar::cos ( FloatingPoint ( 2 * j - 1 ) * pi / FloatingPoint ( 2 * N + 1 ) );
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps, const FloatingPoint& coef2, const bool& even, std::span<const FloatingPoint> b, FloatingPoint x, FloatingPoint lo = FloatingPoint ( 0 ), FloatingPoint hi = FloatingPoint ( 0 ))
 
 //****************************************************************************80
 //
@@ -53,13 +476,21 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
 //
 //    ABWE1 calculates a Kronrod abscissa and weight.
 //
+//  Discussion:
+//
+//    If an interval ( LO, HI ) is given, it must contain exactly one
+//    Kronrod abscissa.  KRONROD passes the neighbouring Gauss abscissas,
+//    which interlace with the Kronrod abscissas.  A Newton step that
+//    leaves the interval is then replaced by a bisection step, so the
+//    iteration cannot diverge or settle on the wrong abscissa.
+//
 //  Licensing:
 //
 //    This code is distributed under the GNU LGPL license.
 //
 //  Modified:
 //
-//    03 August 2010
+//    18 October 2026
 //
 //  Author:
 //
@@ -79,9 +510,7 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
 //
 //    Input, int N, the order of the Gauss rule.
 //
-//    Input, int M, the value of ( N + 1 ) / 2.
-//
-//    Input, FloatingPoint EPS, the requested absolute accuracy of the
+//    Input, FloatingPoint EPS, the requested relative accuracy of the
 //    abscissas.
 //
 //    Input, FloatingPoint COEF2, a value needed to compute weights.
@@ -90,32 +519,39 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
 //
 //    Input, FloatingPoint B[M+1], the Chebyshev coefficients.
 //
-//    Input/output, FloatingPoint *X; on input, an estimate for
-//    the abscissa, and on output, the computed abscissa.
+//    Input, FloatingPoint X, an estimate for the abscissa.
 //
-//    Output, FloatingPoint *W, the weight.
+//    Input, FloatingPoint LO, HI, an interval containing the abscissa.
+//    If LO is not less than HI, no interval is used.
+//
+//    Output, FloatingPoint X, the computed abscissa.
+//
+//    Output, FloatingPoint W, the weight.
 //
 {
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
   FloatingPoint ai;
-  FloatingPoint b0;
-  FloatingPoint b1;
-  FloatingPoint b2;
   FloatingPoint d0;
   FloatingPoint d1;
   FloatingPoint d2;
   FloatingPoint delta;
-  FloatingPoint dif;
+  FloatingPoint delta_old = FloatingPoint ( 0 );
   FloatingPoint f;
   FloatingPoint fd;
-  FloatingPoint yy;
+  FloatingPoint f_hi;
+  FloatingPoint fd_hi;
+  FloatingPoint xnew;
 
-  int M = ( N + 1 ) / 2;
-  int i;
+  bool bracket;
   int iter;
+  int iter_max;
   int k;
   int ka;
+  int sign_hi = 0;
+  int status;
 
-  if ( x == 0.0 )
+  if ( x == FloatingPoint ( 0 ) )
   {
     ka = 1;
   }
@@ -123,67 +559,83 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
   {
     ka = 0;
   }
+
+  bracket = ( ka != 1 && lo < hi );
+
+  if ( bracket && !( lo < x && x < hi ) )
+  {
+    x = ( lo + hi ) / FloatingPoint ( 2 );
+  }
+//
+//  Bisection alone would need about DIGITS steps.
+//
+  iter_max = 50;
+  if ( bracket )
+  {
+    iter_max = 50 + scalar::digits ( );
+  }
 //
 //  Iterative process for the computation of a Kronrod abscissa.
 //
-  for ( iter = 1; iter <= 50; iter++ )
+  for ( iter = 1; iter <= iter_max; iter++ )
   {
-    b1 = 0.0;
-    b2 = b[M];
-    yy = 4.0 * (x) * (x) - 2.0;
-    d1 = 0.0;
-
-    if ( even )
-    {
-      ai = M + M + 1;
-      d2 = ai * b[M];
-      dif = 2.0;
-    }
-    else
+    kronrod_stieltjes<FloatingPoint> ( N, even, b, x, f, fd );
+//
+//  Once the sign at HI is known, each new value shrinks the interval.
+//
+    if ( sign_hi != 0 )
     {
-      ai = M + 1;
-      d2 = 0.0;
-      dif = 1.0;
+      if ( ( FloatingPoint ( 0 ) < f ) == ( 0 < sign_hi ) )
+      {
+        hi = x;
+      }
+      else
+      {
+        lo = x;
+      }
     }
+//
+//  Newton correction, safeguarded by bisection.
+//
+    delta = f / fd;
+    xnew = x - delta;
 
-    for ( k = 1; k <= M; k++ )
+    if ( ka != 1 && bracket && !( lo < xnew && xnew < hi ) )
     {
-      ai = ai - dif;
-      i = M - k + 1;
-      b0 = b1;
-      b1 = b2;
-      d0 = d1;
-      d1 = d2;
-      b2 = yy * b1 - b0 + b[i-1];
-      if ( !even )
+      if ( sign_hi == 0 )
       {
-        i = i + 1;
+        kronrod_stieltjes<FloatingPoint> ( N, even, b, hi, f_hi, fd_hi );
+        sign_hi = ( FloatingPoint ( 0 ) < f_hi ) ? 1 : -1;
+        if ( ( FloatingPoint ( 0 ) < f ) == ( 0 < sign_hi ) )
+        {
+          hi = x;
+        }
+        else
+        {
+          lo = x;
+        }
       }
-      d2 = yy * d1 - d0 + ai * b[i-1];
+      xnew = ( lo + hi ) / FloatingPoint ( 2 );
+      delta = x - xnew;
+      delta_old = FloatingPoint ( 0 );
     }
 
-    if ( even )
-    {
-      f = ( x ) * ( b2 - b1 );
-      fd = d2 + d1;
-    }
-    else
+    x = xnew;
+
+    if ( ka == 1 )
     {
-      f = 0.5 * ( b2 - b0 );
-      fd = 4.0 * ( x ) * d2;
+      break;
     }
-//
-//  Newton correction.
-//
-    delta = f / fd;
-    x = x - delta;
 
-    if ( ka == 1 )
+    status = kronrod_newton_test<FloatingPoint> ( eps, x, delta, delta_old );
+
+    if ( status == 2 || ( sign_hi != 0 && hi - lo <= r8_epsilon<FloatingPoint> ( ) * scalar::abs ( x ) ) )
     {
+      ka = 1;
       break;
     }
 
-    if ( fabs ( delta ) <= eps )
+    if ( status == 1 )
     {
       ka = 1;
     }
@@ -196,20 +648,21 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
     std::cout << "\n";
     std::cout << "ABWE1 - Fatal error!\n";
     std::cout << "  Iteration limit reached.\n";
-    std::cout << "  EPS is " << eps << "\n";
-    std::cout << "  Last DELTA was " << delta << "\n";
+    std::cout << "  EPS is " << static_cast<long double> ( eps ) << "\n";
+    std::cout << "  Last DELTA was " << static_cast<long double> ( delta ) << "\n";
     exit ( 1 );
   }
 //
 //  Computation of the weight.
 //
-  d0 = 1.0;
+  d0 = FloatingPoint ( 1 );
   d1 = x;
-  ai = 0.0;
+  d2 = x;
+  ai = FloatingPoint ( 0 );
   for ( k = 2; k <= N; k++ )
   {
-    ai = ai + 1.0;
-    d2 = ( ( ai + ai + 1.0 ) * ( x ) * d1 - ai * d0 ) / ( ai + 1.0 );
+    ai = ai + FloatingPoint ( 1 );
+    d2 = ( ( ai + ai + FloatingPoint ( 1 ) ) * ( x ) * d1 - ai * d0 ) / ( ai + FloatingPoint ( 1 ) );
     d0 = d1;
     d1 = d2;
   }
@@ -219,9 +672,10 @@ std::tuple<FloatingPoint, FloatingPoint> abwe1 (int N, const FloatingPoint& eps,
 
   return std::make_tuple(x, w);
 }
+//****************************************************************************80
 
 template <typename FloatingPoint>
-std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const FloatingPoint& eps, const FloatingPoint& coef2, const bool& even, const std::vector<FloatingPoint>& b, FloatingPoint x)
+std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const FloatingPoint& eps, const FloatingPoint& coef2, const bool& even, std::span<const FloatingPoint> b, FloatingPoint x, int j = 0)
 
 //****************************************************************************80
 //
@@ -229,13 +683,20 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
 //
 //    ABWE2 calculates a Gaussian abscissa and two weights.
 //
+//  Discussion:
+//
+//    If the index J of the abscissa is given, a Newton step that leaves
+//    the interval of KRONROD_GAUSS_BRACKET, or fails to make progress, is
+//    replaced by a bisection step.  The interval is only computed when
+//    it is first needed.
+//
 //  Licensing:
 //
 //    This code is distributed under the GNU LGPL license.
 //
 //  Modified:
 //
-//    30 April 2013
+//    18 October 2026
 //
 //  Author:
 //
@@ -255,9 +716,7 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
 //
 //    Input, int N, the order of the Gauss rule.
 //
-//    Input, int M, the value of ( N + 1 ) / 2.
-//
-//    Input, FloatingPoint EPS, the requested absolute accuracy of the
+//    Input, FloatingPoint EPS, the requested relative accuracy of the
 //    abscissas.
 //
 //    Input, FloatingPoint COEF2, a value needed to compute weights.
@@ -266,31 +725,46 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
 //
 //    Input, FloatingPoint B[M+1], the Chebyshev coefficients.
 //
-//    Input/output, FloatingPoint *X; on input, an estimate for
-//    the abscissa, and on output, the computed abscissa.
+//    Input, FloatingPoint X, an estimate for the abscissa.
+//
+//    Input, int J, the index of the abscissa, counting from 1 at the
+//    right end, or 0 to iterate without safeguard.
 //
-//    Output, FloatingPoint *W1, the Gauss-Kronrod weight.
+//    Output, FloatingPoint X, the computed abscissa.
 //
-//    Output, FloatingPoint *W2, the Gauss weight.
+//    Output, FloatingPoint W1, the Gauss-Kronrod weight.
+//
+//    Output, FloatingPoint W2, the Gauss weight.
 //
 {
-  FloatingPoint ai;
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
   FloatingPoint an;
   FloatingPoint delta;
+  FloatingPoint delta_old = FloatingPoint ( 0 );
+  FloatingPoint hi = FloatingPoint ( 1 );
+  FloatingPoint lo = -FloatingPoint ( 1 );
   FloatingPoint p0;
   FloatingPoint p1;
   FloatingPoint p2;
-  FloatingPoint pd0;
-  FloatingPoint pd1;
+  FloatingPoint p_hi;
   FloatingPoint pd2;
+  FloatingPoint pd_hi;
+  FloatingPoint pm1_hi;
+  FloatingPoint xnew;
   FloatingPoint yy;
 
+  bool bracket = false;
   int i;
   int iter;
+  int iter_max;
   int k;
   int ka;
   int M = ( N + 1 ) / 2;
-  if ( x == 0.0 )
+  int sign_hi = 0;
+  int status;
+
+  if ( x == FloatingPoint ( 0 ) )
   {
     ka = 1;
   }
@@ -298,56 +772,83 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
   {
     ka = 0;
   }
+
+  iter_max = 50;
+  if ( 0 < j )
+  {
+    iter_max = 50 + scalar::digits ( );
+  }
 //
 //  Iterative process for the computation of a Gaussian abscissa.
 //
-  for ( iter = 1; iter <= 50; iter++ )
+  for ( iter = 1; iter <= iter_max; iter++ )
   {
-    p0 = 1.0;
-    p1 = x;
-    pd0 = 0.0;
-    pd1 = 1.0;
-//
-//  When N is 1, we need to initialize P2 and PD2 to avoid problems with DELTA.
-//
-    if ( N <= 1 )
+    kronrod_legendre<FloatingPoint> ( N, x, p2, pd2, p0 );
+
+    if ( sign_hi != 0 )
     {
-      if ( r8_epsilon<FloatingPoint> ( ) < fabs ( x ) )
+      if ( ( FloatingPoint ( 0 ) < p2 ) == ( 0 < sign_hi ) )
       {
-        p2 = ( 3.0 * ( x ) * ( x ) - 1.0 ) / 2.0;
-        pd2 = 3.0 * ( x );
+        hi = x;
       }
       else
       {
-        p2 = 3.0 * ( x );
-        pd2 = 3.0;
+        lo = x;
       }
     }
-
-    ai = 0.0;
-    for ( k = 2; k <= N; k++ )
-    {
-      ai = ai + 1.0;
-      p2 = ( ( ai + ai + 1.0 ) * (x) * p1 - ai * p0 ) / ( ai + 1.0 );
-      pd2 = ( ( ai + ai + 1.0 ) * ( p1 + (x) * pd1 ) - ai * pd0 ) 
-        / ( ai + 1.0 );
-      p0 = p1;
-      p1 = p2;
-      pd0 = pd1;
-      pd1 = pd2;
-    }
 //
-//  Newton correction.
+//  Newton correction, safeguarded by bisection.
 //
     delta = p2 / pd2;
-    x = x - delta;
+    xnew = x - delta;
+
+    if ( ka != 1 && 0 < j && !bracket 
+      && ( !( -FloatingPoint ( 1 ) < xnew && xnew < FloatingPoint ( 1 ) ) 
+      || ( delta_old != FloatingPoint ( 0 ) && delta_old <= scalar::abs ( delta ) ) ) )
+    {
+      kronrod_gauss_bracket<FloatingPoint> ( N, j, lo, hi );
+      bracket = true;
+    }
+
+    if ( ka != 1 && bracket && !( lo < xnew && xnew < hi ) )
+    {
+      if ( sign_hi == 0 )
+      {
+        kronrod_legendre<FloatingPoint> ( N, hi, p_hi, pd_hi, pm1_hi );
+        sign_hi = ( FloatingPoint ( 0 ) < p_hi ) ? 1 : -1;
+        if ( lo < x && x < hi )
+        {
+          if ( ( FloatingPoint ( 0 ) < p2 ) == ( 0 < sign_hi ) )
+          {
+            hi = x;
+          }
+          else
+          {
+            lo = x;
+          }
+        }
+      }
+      xnew = ( lo + hi ) / FloatingPoint ( 2 );
+      delta = x - xnew;
+      delta_old = FloatingPoint ( 0 );
+    }
+
+    x = xnew;
 
     if ( ka == 1 )
     {
       break;
     }
 
-    if ( fabs ( delta ) <= eps )
+    status = kronrod_newton_test<FloatingPoint> ( eps, x, delta, delta_old );
+
+    if ( status == 2 || ( sign_hi != 0 && hi - lo <= r8_epsilon<FloatingPoint> ( ) * scalar::abs ( x ) ) )
+    {
+      ka = 1;
+      break;
+    }
+
+    if ( status == 1 )
     {
       ka = 1;
     }
@@ -361,8 +862,8 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
     std::cout << "\n";
     std::cout << "ABWE2 - Fatal error!\n";
     std::cout << "  Iteration limit reached.\n";
-    std::cout << "  EPS is " << eps << "\n";
-    std::cout << "  Last DELTA was " << delta << "\n";
+    std::cout << "  EPS is " << static_cast<long double> ( eps ) << "\n";
+    std::cout << "  Last DELTA was " << static_cast<long double> ( delta ) << "\n";
     exit ( 1 );
   }
 //
@@ -370,11 +871,11 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
 //
   an = N;
 
-  FloatingPoint w2 = 2.0 / ( an * pd2 * p0 );
+  FloatingPoint w2 = FloatingPoint ( 2 ) / ( an * pd2 * p0 );
 
-  p1 = 0.0;
+  p1 = FloatingPoint ( 0 );
   p2 = b[M];
-  yy = 4.0 * (x) * (x) - 2.0;
+  yy = FloatingPoint ( 4 ) * (x) * (x) - FloatingPoint ( 2 );
   for ( k = 1; k <= M; k++ )
   {
     i = M - k + 1;
@@ -389,15 +890,69 @@ std::tuple<FloatingPoint, FloatingPoint, FloatingPoint> abwe2 (int N, const Floa
   }
   else
   {
-    w1 = w2 + 2.0 * coef2 / ( pd2 * ( p2 - p0 ) );
+    w1 = w2 + FloatingPoint ( 2 ) * coef2 / ( pd2 * ( p2 - p0 ) );
   }
 
   return std::make_tuple(x, w1, w2);
 }
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_workspace
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_WORKSPACE holds the scratch arrays of KRONROD between calls.
+//
+//  Discussion:
+//
+//    The arrays only ever grow.  Once a workspace has been used for the
+//    largest order needed, later calls of KRONROD with it, writing into
+//    caller storage, do not allocate.
+//
+//    The arrays take their memory from RESOURCE, so that a thread can
+//    keep its scratch space in its own arena.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  std::pmr::vector<FloatingPoint> b;
+  std::pmr::vector<FloatingPoint> tau;
+
+  explicit kronrod_workspace ( 
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource ( ) )
+    : b ( resource ), tau ( resource )
+  {
+  }
+
+  void reserve ( int N )
+  {
+    int m = ( N + 1 ) / 2;
 
+    if ( b.size ( ) < std::size_t ( m + 1 ) )
+    {
+      b.resize ( m + 1 );
+    }
+    if ( tau.size ( ) < std::size_t ( m ) )
+    {
+      tau.resize ( m );
+    }
+  }
+};
+//****************************************************************************80
 
 template <typename FloatingPoint>
-std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<FloatingPoint>> kronrod (int N, const FloatingPoint& eps)
+void kronrod (int N, const FloatingPoint& eps, kronrod_workspace<FloatingPoint>& work, 
+  std::span<FloatingPoint> x, std::span<FloatingPoint> w1, std::span<FloatingPoint> w2, 
+  int threads = 1)
 
 //****************************************************************************80
 //
@@ -421,6 +976,13 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
 //    Note that the code published in Mathematics of Computation 
 //    omitted the definition of the variable which is here called COEF2.
 //
+//    Unlike the published code, all the Gaussian abscissas are computed
+//    first, each in an interval known to contain it.  Since the Kronrod
+//    and Gaussian abscissas interlace, the Kronrod abscissas are then
+//    computed between their converged Gaussian neighbours.  The
+//    abscissas of each pass are independent, and are computed on THREADS
+//    threads.
+//
 //  Storage:
 //
 //    Given N, let M = ( N + 1 ) / 2.  
@@ -479,9 +1041,12 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
 //
 //    Input, int N, the order of the Gauss rule.
 //
-//    Input, FloatingPoint EPS, the requested absolute accuracy of the
+//    Input, FloatingPoint EPS, the requested relative accuracy of the
 //    abscissas.
 //
+//    Input/output, kronrod_workspace<FloatingPoint> &WORK, scratch space,
+//    which may be reused between calls.
+//
 //    Output, FloatingPoint X[N+1], the abscissas.
 //
 //    Output, FloatingPoint W1[N+1], the weights for the Gauss-Kronrod rule.
@@ -489,12 +1054,20 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
 //    Output, FloatingPoint W2[N+1], the weights for 
 //    the Gauss rule.
 //
+//    Input, int THREADS, the number of threads to compute the abscissas
+//    with.  The default of 1 computes them on the calling thread.
+//
 {
-  std::vector<FloatingPoint> x(N+1);
-  std::vector<FloatingPoint> w1(N+1);
-  std::vector<FloatingPoint> w2(N+1);
+  if ( x.size ( ) < std::size_t ( N + 1 ) || w1.size ( ) < std::size_t ( N + 1 ) 
+    || w2.size ( ) < std::size_t ( N + 1 ) )
+  {
+    std::cout << "\n";
+    std::cout << "KRONROD - Fatal error!\n";
+    std::cout << "  The output arrays must have at least N+1 = " << N + 1 
+              << " entries.\n";
+    exit ( 1 );
+  }
 
-//   return std::make_tuple(x, w1, w2);
   FloatingPoint ak;
   FloatingPoint an;
   FloatingPoint bb;
@@ -514,34 +1087,33 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
 
   int m = ( N + 1 ) / 2;
 
-  std::vector<FloatingPoint> b(m+1);
-  std::vector<FloatingPoint> tau(m); 
-  // std::array<FloatingPoint, N+1> x, w1, w2;
-  
+  work.reserve ( N );
+  std::pmr::vector<FloatingPoint>& b = work.b;
+  std::pmr::vector<FloatingPoint>& tau = work.tau;
   
   even = ( 2 * m == N );
 
-  d = 2.0;
-  an = 0.0;
+  d = FloatingPoint ( 2 );
+  an = FloatingPoint ( 0 );
   for ( k = 1; k <= N; k++ )
   {
-    an = an + 1.0;
-    d = d * an / ( an + 0.5 );
+    an = an + FloatingPoint ( 1 );
+    d = d * an / ( an + FloatingPoint ( 1 ) / FloatingPoint ( 2 ) );
   }
 //
 //  Calculation of the Chebyshev coefficients of the orthogonal polynomial.
 //
-  tau[0] = ( an + 2.0 ) / ( an + an + 3.0 );
-  b[m-1] = tau[0] - 1.0;
+  tau[0] = ( an + FloatingPoint ( 2 ) ) / ( an + an + FloatingPoint ( 3 ) );
+  b[m-1] = tau[0] - FloatingPoint ( 1 );
   ak = an;
 
   for ( l = 1; l < m; l++ )
   {
-    ak = ak + 2.0;
-    tau[l] = ( ( ak - 1.0 ) * ak 
-      - an * ( an + 1.0 ) ) * ( ak + 2.0 ) * tau[l-1] 
-      / ( ak * ( ( ak + 3.0 ) * ( ak + 2.0 ) 
-      - an * ( an + 1.0 ) ) );
+    ak = ak + FloatingPoint ( 2 );
+    tau[l] = ( ( ak - FloatingPoint ( 1 ) ) * ak 
+      - an * ( an + FloatingPoint ( 1 ) ) ) * ( ak + FloatingPoint ( 2 ) ) * tau[l-1] 
+      / ( ak * ( ( ak + FloatingPoint ( 3 ) ) * ( ak + FloatingPoint ( 2 ) ) 
+      - an * ( an + FloatingPoint ( 1 ) ) ) );
     b[m-l-1] = tau[l];
 
     for ( ll = 1; ll <= l; ll++ )
@@ -550,15 +1122,17 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
     }
   }
 
-  b[m] = 1.0;
+  b[m] = FloatingPoint ( 1 );
 //
 //  Calculation of approximate values for the abscissas.
 //
-  bb = sin ( 1.570796 / ( an + an + 1.0 ) );
-  x1 = sqrt ( 1.0 - bb * bb );
-  s = 2.0 * bb * x1;
-  c = sqrt ( 1.0 - s * s );
-  coef = 1.0 - ( 1.0 - 1.0 / an ) / ( 8.0 * an * an );
+  bb = kronrod_scalar<FloatingPoint>::sin ( kronrod_scalar<FloatingPoint>::pi ( ) 
+    / ( FloatingPoint ( 2 ) * ( an + an + FloatingPoint ( 1 ) ) ) );
+  x1 = kronrod_scalar<FloatingPoint>::sqrt ( FloatingPoint ( 1 ) - bb * bb );
+  s = FloatingPoint ( 2 ) * bb * x1;
+  c = kronrod_scalar<FloatingPoint>::sqrt ( FloatingPoint ( 1 ) - s * s );
+  coef = FloatingPoint ( 1 ) 
+    - ( FloatingPoint ( 1 ) - FloatingPoint ( 1 ) / an ) / ( FloatingPoint ( 8 ) * an * an );
   xx = coef * x1;
 //
 //  Coefficient needed for weights.
@@ -566,66 +1140,186 @@ std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<F
 //  COEF2 = 2^(2*N+1) * N! * N! / (2n+1)! 
 //        = 2 * 4^N * N! / product( (N+1)*...*(2*N+1))
 //
-  coef2 = 2.0 / FloatingPoint(2 * N + 1);
+  coef2 = FloatingPoint ( 2 ) / FloatingPoint ( 2 * N + 1 );
   for ( i = 1; i <= N; i++ )
   {
-    coef2 = coef2 * 4.0 * FloatingPoint( i ) / FloatingPoint(N + i);
+    coef2 = coef2 * FloatingPoint ( 4 ) * FloatingPoint ( i ) / FloatingPoint ( N + i );
   }
 //
-//  Calculation of the K-th abscissa (a Kronrod abscissa) and the
-//  corresponding weight.
+//  Initial estimates of all the abscissas.  The last one is the origin.
 //
-  for ( k = 1; k <= N; k = k + 2 )
+  for ( k = 0; k < N; k++ )
   {
-    FloatingPoint w1k, w2k;
-    std::tie(xx, w1k) = abwe1<FloatingPoint>(N, eps, coef2, even, b, xx);
-
-    w1[k-1] = w1k;
-    w2[k-1] = 0.0;
-
-    x[k-1] = xx;
+    x[k] = xx;
     y = x1;
     x1 = y * c - bb * s;
     bb = y * s + bb * c;
+    xx = coef * x1;
+  }
+  x[N] = FloatingPoint ( 0 );
+//
+//  Calculation of the Gaussian abscissas, X[1], X[3], ..., and the
+//  corresponding weights.  Each one is safeguarded by its own interval.
+//
+  std::span<const FloatingPoint> bc ( b.data ( ), m + 1 );
 
-    if ( k == N )
+  kronrod_parallel_for ( m, threads, [&] ( int j )
+  {
+    int k = 2 * j + 1;
+    std::tie ( x[k], w1[k], w2[k] ) 
+      = abwe2<FloatingPoint> ( N, eps, coef2, even, bc, x[k], j + 1 );
+  } );
+//
+//  Calculation of the Kronrod abscissas, X[0], X[2], ..., and the
+//  corresponding weights.  Each one lies between two Gaussian abscissas,
+//  or between the largest one and 1.  If N is even, the last one is the
+//  origin.
+//
+  kronrod_parallel_for ( N / 2 + 1, threads, [&] ( int j )
+  {
+    int k = 2 * j;
+    FloatingPoint hi = FloatingPoint ( 1 );
+    FloatingPoint lo = FloatingPoint ( 0 );
+
+    if ( 0 < k )
     {
-      xx = 0.0;
+      hi = x[k-1];
     }
-    else
+    if ( k < N )
     {
-      xx = coef * x1;
+      lo = x[k+1];
     }
+
+    std::tie ( x[k], w1[k] ) 
+      = abwe1<FloatingPoint> ( N, eps, coef2, even, bc, x[k], lo, hi );
+    w2[k] = FloatingPoint ( 0 );
+  } );
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<FloatingPoint>> kronrod (int N, const FloatingPoint& eps)
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD returns the rule in newly allocated vectors.
+//
+//  Discussion:
+//
+//    This is a convenience version of the routine above, which writes
+//    into caller storage.  Repeated generation should call that one with
+//    a reused KRONROD_WORKSPACE instead.
+//
+//  Modified:
 //
-//  Calculation of the K+1 abscissa (a Gaussian abscissa) and the
-//  corresponding weights.
+//    18 October 2026
 //
-    std::tie(xx, w1k, w2k) = abwe2<FloatingPoint>(N, eps, coef2, even, b, xx);
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, FloatingPoint EPS, the requested relative accuracy of the
+//    abscissas.
+//
+//    Output, FloatingPoint X[N+1], W1[N+1], W2[N+1], as for KRONROD.
+//
+{
+  std::vector<FloatingPoint> x(N+1);
+  std::vector<FloatingPoint> w1(N+1);
+  std::vector<FloatingPoint> w2(N+1);
+  kronrod_workspace<FloatingPoint> work;
 
-    w1[k] = w1k;
-    w2[k] = w2k;
+  kronrod<FloatingPoint> ( N, eps, work, x, w1, w2 );
 
-    x[k] = xx;
-    y = x1;
-    x1 = y * c - bb * s;
-    bb = y * s + bb * c;
-    xx = coef * x1;
-  }
+  return std::make_tuple(x, w1, w2);
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+std::tuple<std::pmr::vector<FloatingPoint>, std::pmr::vector<FloatingPoint>, std::pmr::vector<FloatingPoint>> kronrod (int N, const FloatingPoint& eps, std::pmr::memory_resource *resource)
+
+//****************************************************************************80
 //
-//  If N is even, we have one more Kronrod abscissa to compute,
-//  namely the origin.
+//  Purpose:
 //
-  if ( even )
-  {
-    xx = 0.0;
-    FloatingPoint w1n;
-    std::tie(xx, w1n) = abwe1<FloatingPoint>(N, eps, coef2, even, b, xx);
+//    KRONROD returns the rule in vectors allocated from a memory resource.
+//
+//  Discussion:
+//
+//    Both the output and the workspace come from RESOURCE.  A thread
+//    that generates many rules can pass a monotonic arena built on its
+//    own unsynchronized pool, so that it never goes to the global
+//    allocator once the pool is warm.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, FloatingPoint EPS, the requested relative accuracy of the
+//    abscissas.
+//
+//    Input, std::pmr::memory_resource *RESOURCE, the memory to use.
+//
+//    Output, FloatingPoint X[N+1], W1[N+1], W2[N+1], as for KRONROD.
+//
+{
+  std::pmr::vector<FloatingPoint> x(N+1, resource);
+  std::pmr::vector<FloatingPoint> w1(N+1, resource);
+  std::pmr::vector<FloatingPoint> w2(N+1, resource);
+  kronrod_workspace<FloatingPoint> work ( resource );
 
-    w1[N] = w1n;
-    w2[N] = 0.0;
-    x[N] = xx;
-  }
+  kronrod<FloatingPoint> ( N, eps, work, x, w1, w2 );
 
-  return std::make_tuple(x, w1, w2);
+  return std::make_tuple(std::move(x), std::move(w1), std::move(w2));
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+std::tuple<std::vector<FloatingPoint>, std::vector<FloatingPoint>, std::vector<FloatingPoint>> kronrod (int N)
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD computes the rule with a tolerance chosen for the type.
+//
+//  Discussion:
+//
+//    The tolerance is KRONROD_EPS<FloatingPoint>(), which follows from
+//    std::numeric_limits<FloatingPoint>::digits, so a 50 digit type is
+//    not under resolved and double is not over resolved.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Output, FloatingPoint X[N+1], W1[N+1], W2[N+1], as for KRONROD.
+//
+{
+  return kronrod<FloatingPoint> ( N, kronrod_eps<FloatingPoint> ( ) );
 }
 void timestamp ( );
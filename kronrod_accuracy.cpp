@@ -0,0 +1,297 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include "kronrodT.hpp"
+#include "kronrod_integrateT.hpp"
+#include "kronrod_recurrenceT.hpp"
+
+// Differential accuracy harness: every way the library has of producing a
+// rule in a hardware type is compared with kronrod<cpp_dec_float_50>.
+//
+//   kronrod_accuracy [max_n]
+//
+// For N = 1..40 and then 50, 64, 100, 128, 200, 256, ... up to MAX_N
+// (default 1024), and for each path, it reports
+//
+//   the largest error of the abscissas and of the two sets of weights, in
+//   units in the last place of the reference, so that a correctly rounded
+//   rule shows 0.5;
+//
+//   the largest error, in units of the type's epsilon, of the integrals of
+//   the Legendre polynomials P(K), whose exact values are 2 for K = 0 and
+//   0 otherwise, up to degree 3N+1 for the Kronrod weights and 2N-1 for
+//   the Gauss weights, with the sums done in cpp_bin_float_50 so that only
+//   the rounding of the rule counts;
+//
+//   whether the abscissas decrease strictly to X[N] = 0, the Gauss and
+//   Kronrod abscissas alternate, and the weights are positive.
+//
+// A path fails if the layout is wrong or an error exceeds its bound, and
+// the program then exits with status 1, which is what ctest looks at.  The
+// bounds are the accuracy each path has today, with a margin of 2 to 10;
+// a change that makes a path less accurate has to raise them, in plain
+// sight.
+//
+// The rules computed in double or long double do not stay within an ulp as
+// N grows.  Their absolute errors stay within some hundreds of epsilon, but
+// the abscissas nearest 0, of size 1/N, and the weights nearest the ends,
+// of size 1/N^2, are small, so their errors in ulps grow like N^2 and N^3:
+// at N = 1024, by thousands of ulps in the abscissas and 1.0E+08 in the
+// weights.  The integrals of the polynomials, which is what matters to
+// the user, stay within 1000 epsilon.  The tables and the float rules,
+// rounded from multiprecision and from double, are within half an ulp.
+
+using namespace boost::multiprecision;
+using Reference = cpp_dec_float_50;
+using Sum = cpp_bin_float_50;
+
+struct rule_error {
+    double ulp_x = 0.0;
+    double ulp_w1 = 0.0;
+    double ulp_w2 = 0.0;
+    double exact_k = 0.0;
+    double exact_g = 0.0;
+    bool layout = true;
+};
+
+struct reference_rule {
+    std::vector<Reference> x;
+    std::vector<Reference> w1;
+    std::vector<Reference> w2;
+};
+
+// |v - r| in units in the last place of r in type T; a zero reference
+// must be matched exactly.
+template <typename T>
+double ulps(const T& v, const Reference& r){
+
+    if (r == 0) {
+        return (v == T(0)) ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    T rt = static_cast<T>(r);
+    T a = std::abs(rt);
+    T ulp = std::nextafter(a, std::numeric_limits<T>::infinity()) - a;
+    return static_cast<double>(abs(Reference(v) - r) / Reference(ulp));
+}
+
+template <typename T>
+rule_error measure(int n, const reference_rule& ref,
+    const std::vector<T>& x, const std::vector<T>& w1, const std::vector<T>& w2){
+
+    rule_error e;
+
+    for (int i = 0; i <= n; i++) {
+        e.ulp_x = std::max(e.ulp_x, ulps(x[i], ref.x[i]));
+        e.ulp_w1 = std::max(e.ulp_w1, ulps(w1[i], ref.w1[i]));
+        e.ulp_w2 = std::max(e.ulp_w2, ulps(w2[i], ref.w2[i]));
+    }
+
+    // Layout: X decreasing to 0, Gauss abscissas where W2 is nonzero, at
+    // the odd positions and at 0 for odd N, and positive weights.
+    e.layout = (x[n] == T(0));
+    for (int i = 0; i <= n; i++) {
+        bool gauss = (i < n) ? (i % 2 == 1) : (n % 2 == 1);
+        e.layout = e.layout && (i == n || x[i + 1] < x[i])
+            && (T(0) < w1[i]) && ((T(0) < w2[i]) == gauss) && (gauss || w2[i] == T(0));
+    }
+
+    // Integrals of P(K) for even K; the odd ones vanish by symmetry.
+    int kmax = 3 * n + 1;
+    std::vector<Sum> xs(n + 1);
+    std::vector<Sum> p0(n + 1, Sum(0));
+    std::vector<Sum> p1(n + 1, Sum(1));
+    for (int i = 0; i <= n; i++) {
+        xs[i] = Sum(x[i]);
+    }
+    double eps = static_cast<double>(std::numeric_limits<T>::epsilon());
+    for (int k = 0; k <= kmax; k++) {
+        if (k % 2 == 0) {
+            Sum q1 = Sum(w1[n]) * p1[n];
+            Sum q2 = Sum(w2[n]) * p1[n];
+            for (int i = 0; i < n; i++) {
+                q1 += 2 * Sum(w1[i]) * p1[i];
+                q2 += 2 * Sum(w2[i]) * p1[i];
+            }
+            Sum exact = (k == 0) ? Sum(2) : Sum(0);
+            e.exact_k = std::max(e.exact_k, static_cast<double>(abs(q1 - exact)) / eps);
+            if (k <= 2 * n - 1) {
+                e.exact_g = std::max(e.exact_g, static_cast<double>(abs(q2 - exact)) / eps);
+            }
+        }
+        // P(K+1) = ( (2K+1) X P(K) - K P(K-1) ) / (K+1)
+        for (int i = 0; i <= n; i++) {
+            Sum p2 = ((2 * k + 1) * xs[i] * p1[i] - k * p0[i]) / (k + 1);
+            p0[i] = p1[i];
+            p1[i] = p2;
+        }
+    }
+
+    return e;
+}
+
+// The bound FLOOR + COEF * N^POWER.
+struct bound {
+    double floor;
+    double coef;
+    int power;
+
+    double at(int n) const {
+        return floor + coef * std::pow(double(n), power);
+    }
+};
+
+struct path {
+    std::string name;
+    bound ulp_x;
+    bound ulp_w;
+    bound exact;
+    std::function<bool(int, const reference_rule&, rule_error&)> run;
+};
+
+bool check(const path& p, int n, const rule_error& e){
+
+    return e.layout && e.ulp_x <= p.ulp_x.at(n)
+        && e.ulp_w1 <= p.ulp_w.at(n) && e.ulp_w2 <= p.ulp_w.at(n)
+        && e.exact_k <= p.exact.at(n) && e.exact_g <= p.exact.at(n);
+}
+
+int main(int argc, char** argv){
+
+    int max_n = argc > 1 ? std::stoi(argv[1]) : 1024;
+
+    std::vector<int> orders;
+    for (int n = 1; n <= std::min(40, max_n); n++) {
+        orders.push_back(n);
+    }
+    for (int n = 50; n <= max_n; n *= 2) {
+        for (int m : {n, n * 64 / 50, n * 2}) {
+            if (40 < m && m <= max_n) {
+                orders.push_back(m);
+            }
+        }
+    }
+    std::sort(orders.begin(), orders.end());
+    orders.erase(std::unique(orders.begin(), orders.end()), orders.end());
+
+    std::vector<path> paths;
+
+    // Generated in the working type.
+    const bound ulp_x{8.0, 0.05, 2};
+    const bound ulp_w{8.0, 1.0, 3};
+    const bound exact{16.0, 8.0, 1};
+
+    paths.push_back({"double", ulp_x, ulp_w, exact,
+        [](int n, const reference_rule& ref, rule_error& e){
+            auto [x, w1, w2] = kronrod<double>(n);
+            e = measure(n, ref, x, w1, w2);
+            return true;
+        }});
+
+    paths.push_back({"double, 4 threads", ulp_x, ulp_w, exact,
+        [](int n, const reference_rule& ref, rule_error& e){
+            kronrod_workspace<double> work;
+            std::vector<double> x(n + 1), w1(n + 1), w2(n + 1);
+            kronrod<double>(n, kronrod_eps<double>(), work, x, w1, w2, 4);
+            e = measure(n, ref, x, w1, w2);
+            return true;
+        }});
+
+#ifdef KRONROD_HAVE_TABLES
+    paths.push_back({"double, table", {0.5, 0.0, 0}, {0.5, 0.0, 0}, {4.0, 0.0, 0},
+        [](int n, const reference_rule& ref, rule_error& e){
+            const kronrod_table* table = kronrod_table_find(n);
+            if (!table) {
+                return false;
+            }
+            std::vector<double> x(table->x, table->x + n + 1);
+            std::vector<double> w1(table->w1, table->w1 + n + 1);
+            std::vector<double> w2(table->w2, table->w2 + n + 1);
+            e = measure(n, ref, x, w1, w2);
+            return true;
+        }});
+#endif
+
+    paths.push_back({"long double", ulp_x, ulp_w, exact,
+        [](int n, const reference_rule& ref, rule_error& e){
+            auto [x, w1, w2] = kronrod<long double>(n);
+            e = measure(n, ref, x, w1, w2);
+            return true;
+        }});
+
+    // Rounded twice, to double and then to float; the first rounding is off
+    // by up to 1.0E+08 ulps of double, which is 0.2 ulps of float.
+    paths.push_back({"float from double", {0.75, 0.0, 0}, {0.75, 0.0, 0}, {8.0, 0.0, 0},
+        [](int n, const reference_rule& ref, rule_error& e){
+            kronrod_rule<float> rule(n);
+            e = measure(n, ref, rule.x, rule.w1, rule.w2);
+            return true;
+        }});
+
+    // The eigenvalue solver has absolute errors of some epsilon from N = 1 on,
+    // which are more ulps for the small abscissas and weights than Newton's
+    // method gives at small N, but grow more slowly with N.
+    paths.push_back({"double, recurrence", {32.0, 8.0, 1}, {64.0, 8.0, 2}, exact,
+        [](int n, const reference_rule& ref, rule_error& e){
+            int m = (3 * n + 1) / 2 + 1;
+            std::vector<double> alpha(m, 0.0), beta(m);
+            beta[0] = 2.0;
+            for (int k = 1; k < m; k++) {
+                beta[k] = double(k) * double(k) / (4.0 * double(k) * double(k) - 1.0);
+            }
+            kronrod_weighted_rule<double> full;
+            if (kronrod_from_recurrence(n, alpha, beta, -1.0, 1.0, full) != 0) {
+                e.layout = false;
+                return true;
+            }
+            std::vector<double> x(n + 1), w1(n + 1), w2(n + 1);
+            for (int i = 0; i <= n; i++) {
+                x[i] = (i < n) ? full.x[2 * n - i] : 0.0;
+                w1[i] = full.w1[2 * n - i];
+                w2[i] = full.w2[2 * n - i];
+            }
+            e = measure(n, ref, x, w1, w2);
+            return true;
+        }});
+
+    std::cout << std::setprecision(3);
+    std::cout << "\nKRONROD_ACCURACY: fast paths against kronrod<cpp_dec_float_50>, N = 1 to "
+              << max_n << "\n";
+    std::cout << "\nulps of the abscissas and weights; integrals of P(K) up to degree 3N+1\n"
+              << "(Kronrod) and 2N-1 (Gauss) in units of epsilon; layout and interlacing\n\n";
+    std::cout << "      N  path                   x ulps    w1 ulps    w2 ulps   K/eps   G/eps  layout\n";
+
+    int failures = 0;
+    for (int n : orders) {
+        reference_rule ref;
+        std::tie(ref.x, ref.w1, ref.w2) = kronrod<Reference>(n);
+
+        std::cout << "\n";
+        for (const path& p : paths) {
+            rule_error e;
+            if (!p.run(n, ref, e)) {
+                continue;
+            }
+            bool ok = check(p, n, e);
+            failures += ok ? 0 : 1;
+            std::cout << "  " << std::setw(5) << n
+                      << "  " << std::setw(19) << std::left << p.name << std::right
+                      << "  " << std::setw(9) << e.ulp_x
+                      << "  " << std::setw(9) << e.ulp_w1
+                      << "  " << std::setw(9) << e.ulp_w2
+                      << "  " << std::setw(6) << e.exact_k
+                      << "  " << std::setw(6) << e.exact_g
+                      << "  " << std::setw(6) << (e.layout ? "ok" : "BAD")
+                      << (ok ? "" : "  FAIL") << "\n";
+        }
+    }
+
+    std::cout << "\n" << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
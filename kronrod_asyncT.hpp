@@ -0,0 +1,482 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <coroutine>
+#include <functional>
+#include <exception>
+#include <algorithm>
+
+#include "kronrod_integrateT.hpp"
+
+class kronrod_async_queue
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ASYNC_QUEUE resumes suspended panels on the integrating thread.
+//
+//  Discussion:
+//
+//    The callbacks of an asynchronous integrand may run on any thread.
+//    They only POST the coroutine that waits for them, and RUN, called by
+//    the integrator, resumes the posted coroutines one at a time.  All the
+//    arithmetic therefore happens on the integrating thread.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  void post ( std::coroutine_handle<> h )
+  {
+    {
+      std::lock_guard<std::mutex> lock ( mtx );
+      ready.push_back ( h );
+    }
+    cv.notify_one ( );
+  }
+
+  void run ( int count )
+  {
+    for ( int i = 0; i < count; i++ )
+    {
+      std::coroutine_handle<> h;
+      {
+        std::unique_lock<std::mutex> lock ( mtx );
+        cv.wait ( lock, [this] ( ) { return !ready.empty ( ); } );
+        h = ready.front ( );
+        ready.pop_front ( );
+      }
+      h.resume ( );
+    }
+  }
+
+private:
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::coroutine_handle<>> ready;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+class kronrod_async_values
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ASYNC_VALUES awaits the values of F at a set of abscissas.
+//
+//  Discussion:
+//
+//    Awaiting it issues all the requests F ( X[K], DONE ) at once and
+//    suspends.  Each DONE stores its value in FV[K], and the last one to
+//    arrive posts the awaiting coroutine to QUEUE.  The requests are
+//    counted before the first is issued, so a DONE called from within F
+//    cannot post early.
+//
+//    If F throws, the remaining requests are not issued, and the
+//    exception is rethrown by the CO_AWAIT once the issued ones have
+//    answered.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  kronrod_async_values ( Function& f, const std::vector<FloatingPoint>& x,
+    std::vector<FloatingPoint>& fv, kronrod_async_queue& queue )
+    : f ( f ), x ( x ), fv ( fv ), queue ( queue )
+  {
+  }
+
+  bool await_ready ( ) const
+  {
+    return x.empty ( );
+  }
+
+  void await_suspend ( std::coroutine_handle<> h )
+  {
+    int m = int ( x.size ( ) );
+    pending.store ( m );
+    fv.resize ( m );
+    for ( int k = 0; k < m; k++ )
+    {
+      try
+      {
+        f ( x[k], [this, k, h] ( FloatingPoint value )
+        {
+          fv[k] = value;
+          if ( pending.fetch_sub ( 1 ) == 1 )
+          {
+            queue.post ( h );
+          }
+        } );
+      }
+      catch ( ... )
+      {
+//
+//  The requests not issued will not answer.  Wait for the others.
+//
+        error = std::current_exception ( );
+        if ( pending.fetch_sub ( m - k ) == m - k )
+        {
+          queue.post ( h );
+        }
+        return;
+      }
+    }
+  }
+
+  void await_resume ( ) const
+  {
+    if ( error )
+    {
+      std::rethrow_exception ( error );
+    }
+  }
+
+private:
+
+  Function& f;
+  const std::vector<FloatingPoint>& x;
+  std::vector<FloatingPoint>& fv;
+  kronrod_async_queue& queue;
+  std::atomic<int> pending;
+  std::exception_ptr error;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+class kronrod_async_panel
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ASYNC_PANEL is the coroutine that integrates one subinterval.
+//
+//  Discussion:
+//
+//    The coroutine starts at once, so that its requests are in flight as
+//    soon as it is created, and stays suspended at the end until RESULT
+//    has been read.  The frame is destroyed with the object.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  struct promise_type
+  {
+    kronrod_interval<FloatingPoint> value;
+    std::exception_ptr error;
+
+    kronrod_async_panel get_return_object ( )
+    {
+      return kronrod_async_panel (
+        std::coroutine_handle<promise_type>::from_promise ( *this ) );
+    }
+
+    std::suspend_never initial_suspend ( ) noexcept
+    {
+      return std::suspend_never ( );
+    }
+
+    std::suspend_always final_suspend ( ) noexcept
+    {
+      return std::suspend_always ( );
+    }
+
+    void return_value ( const kronrod_interval<FloatingPoint>& v )
+    {
+      value = v;
+    }
+
+    void unhandled_exception ( )
+    {
+      error = std::current_exception ( );
+    }
+  };
+
+  explicit kronrod_async_panel ( std::coroutine_handle<promise_type> h ) : h ( h )
+  {
+  }
+
+  kronrod_async_panel ( kronrod_async_panel&& other ) noexcept : h ( other.h )
+  {
+    other.h = nullptr;
+  }
+
+  kronrod_async_panel ( const kronrod_async_panel& ) = delete;
+  kronrod_async_panel& operator = ( const kronrod_async_panel& ) = delete;
+
+  ~kronrod_async_panel ( )
+  {
+    if ( h )
+    {
+      h.destroy ( );
+    }
+  }
+
+  const kronrod_interval<FloatingPoint>& result ( ) const
+  {
+    if ( h.promise ( ).error )
+    {
+      std::rethrow_exception ( h.promise ( ).error );
+    }
+    return h.promise ( ).value;
+  }
+
+private:
+
+  std::coroutine_handle<promise_type> h;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_async_panel<FloatingPoint> kronrod_qk_async ( const kronrod_rule<FloatingPoint>& rule,
+  Function& f, FloatingPoint a, FloatingPoint b, kronrod_async_queue& queue )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_ASYNC applies a Gauss-Kronrod rule to an asynchronous F.
+//
+//  Discussion:
+//
+//    All the 2*N+1 values are requested together, and the estimates are
+//    those of KRONROD_QK_SUMS.  A and B are taken by value, since the
+//    coroutine outlives the call.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, Function &F, the integrand, see KRONROD_INTEGRATE_ASYNC.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input/output, kronrod_async_queue &QUEUE, where the panel is resumed.
+//
+//    Output, kronrod_async_panel<FloatingPoint> KRONROD_QK_ASYNC, the
+//    panel, whose RESULT is valid once QUEUE has resumed it.
+//
+{
+  int n = rule.n;
+  FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+  std::vector<FloatingPoint> x ( 2 * n + 1 );
+  std::vector<FloatingPoint> fv;
+
+  x[2*n] = center;
+  for ( int i = 0; i < n; i++ )
+  {
+    FloatingPoint dx = half * rule.x[i];
+    x[2*i] = center - dx;
+    x[2*i+1] = center + dx;
+  }
+
+  co_await kronrod_async_values<FloatingPoint, Function> ( f, x, fv, queue );
+
+  co_return kronrod_qk_sums ( rule, fv, a, b );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate_async ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit = 1000, int batch = 1 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_ASYNC integrates an asynchronous F over [A,B].
+//
+//  Discussion:
+//
+//    F is called as F ( X, DONE ), starts the evaluation at X and returns
+//    at once.  When the value is known, from any thread, it calls
+//    DONE ( VALUE ) exactly once.  This suits integrands that wait on a
+//    server or a device: the latency is paid once per round instead of
+//    once per abscissa.
+//
+//    The algorithm is that of KRONROD_INTEGRATE.  Each round bisects the
+//    BATCH worst subintervals and starts a KRONROD_QK_ASYNC coroutine on
+//    each half, which puts all of its 2*N+1 requests in flight.  The
+//    calling thread then resumes the panels as their values arrive, and
+//    updates the estimates in a fixed order once all have finished.  The
+//    result is therefore the same as that of KRONROD_INTEGRATE with the
+//    same BATCH, whatever the order of arrival.
+//
+//    Each round waits for all of its DONE calls, so none is pending when
+//    this returns.  An exception thrown by F is rethrown here, after the
+//    round in which it occurred.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Input, int BATCH, the number of subintervals bisected per round.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE_ASYNC, the
+//    integral and error estimates.
+//
+{
+  typedef kronrod_interval<FloatingPoint> interval;
+  typedef kronrod_async_panel<FloatingPoint> panel;
+
+  kronrod_worse<FloatingPoint> worse;
+  kronrod_async_queue queue;
+  std::vector<interval> heap;
+  std::vector<interval> parents;
+  std::vector<panel> panels;
+  kronrod_result<FloatingPoint> value;
+  kronrod_sum<FloatingPoint> total;
+  int per_rule = 2 * rule.n + 1;
+
+  batch = std::max ( batch, 1 );
+
+  {
+    panel first = kronrod_qk_async ( rule, f, a, b, queue );
+    queue.run ( 1 );
+    heap.push_back ( first.result ( ) );
+  }
+  total.add ( heap[0].result );
+  value.result = heap[0].result;
+  value.error = heap[0].error;
+  value.evaluations = per_rule;
+  value.intervals = 1;
+  value.ier = 0;
+
+  for ( ; ; )
+  {
+    FloatingPoint tol = std::max ( epsabs,
+      epsrel * kronrod_scalar<FloatingPoint>::abs ( value.result ) );
+
+    if ( value.error <= tol )
+    {
+      break;
+    }
+
+    if ( limit <= value.intervals )
+    {
+      value.ier = 1;
+      break;
+    }
+//
+//  Take the worst subintervals off the heap, and start a panel on each
+//  half.
+//
+    int count = std::min ( batch, limit - value.intervals );
+
+    parents.clear ( );
+    for ( int i = 0; i < count && !heap.empty ( ); i++ )
+    {
+      std::pop_heap ( heap.begin ( ), heap.end ( ), worse );
+      parents.push_back ( heap.back ( ) );
+      heap.pop_back ( );
+    }
+
+    panels.clear ( );
+    for ( const interval& p : parents )
+    {
+      FloatingPoint mid = ( p.a + p.b ) / FloatingPoint ( 2 );
+      panels.push_back ( kronrod_qk_async ( rule, f, p.a, mid, queue ) );
+      panels.push_back ( kronrod_qk_async ( rule, f, mid, p.b, queue ) );
+    }
+//
+//  Resume the panels as their values arrive.
+//
+    queue.run ( int ( panels.size ( ) ) );
+//
+//  Update the estimates in a fixed order, and put the halves on the heap.
+//
+    for ( std::size_t i = 0; i < parents.size ( ); i++ )
+    {
+      const interval& p = parents[i];
+      const interval& h1 = panels[2*i].result ( );
+      const interval& h2 = panels[2*i+1].result ( );
+
+      total.add ( h1.result );
+      total.add ( h2.result );
+      total.add ( - p.result );
+      value.error = value.error + ( ( h1.error + h2.error ) - p.error );
+
+      heap.push_back ( h1 );
+      std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+      heap.push_back ( h2 );
+      std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+    }
+
+    value.result = total.value ( );
+    value.evaluations = value.evaluations + per_rule * int ( panels.size ( ) );
+    value.intervals = value.intervals + int ( parents.size ( ) );
+  }
+//
+//  Sum the final estimates again, to remove the drift of the updates.
+//
+  std::sort ( heap.begin ( ), heap.end ( ),
+    [] ( const interval& p, const interval& q ) { return p.a < q.a; } );
+  kronrod_sum<FloatingPoint> sum;
+  value.error = FloatingPoint ( 0 );
+  for ( const interval& p : heap )
+  {
+    sum.add ( p.result );
+    value.error = value.error + p.error;
+  }
+  value.result = sum.value ( );
+
+  return value;
+}
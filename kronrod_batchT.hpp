@@ -0,0 +1,160 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "kronrod_integrateT.hpp"
+
+template <typename FloatingPoint, typename Function>
+void kronrod_qk_batch ( const kronrod_rule<FloatingPoint>& rule, Function f,
+  const FloatingPoint a[], const FloatingPoint b[], int count,
+  kronrod_interval<FloatingPoint> value[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_BATCH applies a rule to many intervals at once.
+//
+//  Discussion:
+//
+//    VALUE[J] is KRONROD_QK ( RULE, F, A[J], B[J] ), up to rounding.
+//
+//    The intervals are taken in blocks of one 64 byte vector's worth,
+//    16 for float and 8 for double.  For each abscissa of the rule, F is
+//    called and the weights applied across the block in a loop of fixed
+//    length with no dependences between its iterations, so the compiler
+//    can turn it into SIMD instructions, including the calls of F if F
+//    is inline and made of arithmetic and SQRT.  Halving the width of
+//    the type doubles the lanes, which is where float earns its keep.
+//
+//    The last block is filled out by repeating its first interval, so up
+//    to 2*N+1 values of F per missing interval are computed and thrown
+//    away.
+//
+//    In float, with the rules of KRONROD_RULE<float>, which are
+//    generated in double and rounded, the relative error of the result
+//    for a smooth integrand of one sign is about 2.0E-07 for N up to 20,
+//    and grows slowly with N, as the 2*N+1 terms of the sums are
+//    rounded, to about 8.0E-07 at N = 400; see TEST19.  The error
+//    estimate never falls below 50 * FLT_EPSILON = 6.0E-06 times the
+//    integral of |F|, so EPSREL below 1.0E-05 cannot be met, and a high
+//    order buys nothing that a lower one on more intervals does not.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A[COUNT], B[COUNT], the intervals.
+//
+//    Input, int COUNT, the number of intervals.
+//
+//    Output, kronrod_interval<FloatingPoint> VALUE[COUNT], the intervals
+//    with their estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  const int lanes = ( sizeof ( FloatingPoint ) < 64 ) ? int ( 64 / sizeof ( FloatingPoint ) ) : 1;
+
+  int n = rule.n;
+  FloatingPoint c[lanes];
+  FloatingPoint h[lanes];
+  FloatingPoint i1[lanes];
+  FloatingPoint i2[lanes];
+  FloatingPoint resabs[lanes];
+  FloatingPoint resasc[lanes];
+  FloatingPoint mean[lanes];
+  std::vector<FloatingPoint> fv ( ( 2 * n + 1 ) * lanes );
+
+  for ( int start = 0; start < count; start = start + lanes )
+  {
+    int m = std::min ( lanes, count - start );
+
+    for ( int k = 0; k < lanes; k++ )
+    {
+      int j = start + ( ( k < m ) ? k : 0 );
+      c[k] = ( a[j] + b[j] ) / FloatingPoint ( 2 );
+      h[k] = ( b[j] - a[j] ) / FloatingPoint ( 2 );
+    }
+//
+//  Evaluate F.  FV[J*LANES+K] is the J-th value of FV in KRONROD_QK_SUMS
+//  for the K-th interval of the block.
+//
+    FloatingPoint* fc = fv.data ( ) + 2 * n * lanes;
+    for ( int k = 0; k < lanes; k++ )
+    {
+      fc[k] = f ( c[k] );
+    }
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint xi = rule.x[i];
+      FloatingPoint* fl = fv.data ( ) + 2 * i * lanes;
+      FloatingPoint* fr = fl + lanes;
+      for ( int k = 0; k < lanes; k++ )
+      {
+        fl[k] = f ( c[k] - h[k] * xi );
+        fr[k] = f ( c[k] + h[k] * xi );
+      }
+    }
+//
+//  Apply the weights.
+//
+    for ( int k = 0; k < lanes; k++ )
+    {
+      i1[k] = rule.w1[n] * fc[k];
+      i2[k] = rule.w2[n] * fc[k];
+      resabs[k] = rule.w1[n] * scalar::abs ( fc[k] );
+    }
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint w1 = rule.w1[i];
+      FloatingPoint w2 = rule.w2[i];
+      const FloatingPoint* fl = fv.data ( ) + 2 * i * lanes;
+      const FloatingPoint* fr = fl + lanes;
+      for ( int k = 0; k < lanes; k++ )
+      {
+        FloatingPoint fsum = fl[k] + fr[k];
+        i1[k] = i1[k] + w1 * fsum;
+        i2[k] = i2[k] + w2 * fsum;
+        resabs[k] = resabs[k] + w1 * ( scalar::abs ( fl[k] ) + scalar::abs ( fr[k] ) );
+      }
+    }
+
+    for ( int k = 0; k < lanes; k++ )
+    {
+      mean[k] = i1[k] / FloatingPoint ( 2 );
+      resasc[k] = rule.w1[n] * scalar::abs ( fc[k] - mean[k] );
+    }
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint w1 = rule.w1[i];
+      const FloatingPoint* fl = fv.data ( ) + 2 * i * lanes;
+      const FloatingPoint* fr = fl + lanes;
+      for ( int k = 0; k < lanes; k++ )
+      {
+        resasc[k] = resasc[k]
+          + w1 * ( scalar::abs ( fl[k] - mean[k] ) + scalar::abs ( fr[k] - mean[k] ) );
+      }
+    }
+
+    for ( int k = 0; k < m; k++ )
+    {
+      value[start+k] = kronrod_qk_estimate ( a[start+k], b[start+k], i1[k], i2[k],
+        resabs[k], resasc[k] );
+    }
+  }
+
+  return;
+}
+//****************************************************************************80
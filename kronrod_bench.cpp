@@ -0,0 +1,291 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <memory_resource>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include "kronrodT.hpp"
+#include "kronrod_integrateT.hpp"
+#include "kronrod_batchT.hpp"
+
+using namespace boost::multiprecision;
+using FloatingPointType = cpp_bin_float_50;
+
+// Time njobs threads that each generate the orders 2..max_n reps times,
+// either with the global allocator or with a per-thread arena.
+template <typename FloatingPointType>
+double bench_allocation(int njobs, int max_n, int reps, bool use_arena){
+
+    auto worker = [&](){
+        std::pmr::unsynchronized_pool_resource pool;
+        for (int r = 0; r < reps; r++) {
+            for (int n = 2; n <= max_n; n++) {
+                if (use_arena) {
+                    std::pmr::monotonic_buffer_resource arena(&pool);
+                    auto rule = kronrod<FloatingPointType>(n, kronrod_eps<FloatingPointType>(), &arena);
+                }
+                else {
+                    auto rule = kronrod<FloatingPointType>(n);
+                }
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < njobs; i++) {
+        threads.push_back(std::thread(worker));
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench01(int njobs){
+
+    std::cout << "\nBENCH01: rule generation, global allocator vs per-thread arena\n";
+    std::cout << "  threads = " << njobs
+              << ", hardware threads = " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << "  type              max N   reps   global (s)   arena (s)\n";
+
+    auto row = [&](std::string name, auto run, int max_n, int reps){
+        double t_global = run(njobs, max_n, reps, false);
+        double t_arena = run(njobs, max_n, reps, true);
+        std::cout << "  " << std::setw(16) << std::left << name << std::right
+                  << "  " << std::setw(5) << max_n
+                  << "  " << std::setw(5) << reps
+                  << "  " << std::setw(11) << t_global
+                  << "  " << std::setw(10) << t_arena << "\n";
+    };
+
+    row("double", bench_allocation<double>, 40, 200);
+    row("cpp_bin_float_50", bench_allocation<FloatingPointType>, 20, 5);
+}
+
+// An integrand that costs about a microsecond per call.
+double expensive_integrand(double x){
+    double s = 0.0;
+    for (int k = 1; k <= 200; k++) {
+        s += std::sin(k * x) / (k * k);
+    }
+    return 1.0 / ((x - 0.3) * (x - 0.3) + 1e-4) + s;
+}
+
+void bench02(int njobs){
+
+    std::cout << "\nBENCH02: adaptive integration, serial vs parallel rounds\n\n";
+    std::cout << "  threads  batch   intervals   evaluations   time (s)   result\n";
+
+    kronrod_rule<double> rule(7);
+
+    auto row = [&](int threads, int batch){
+        auto start = std::chrono::steady_clock::now();
+        auto r = kronrod_integrate(expensive_integrand, 0.0, 1.0, 0.0, 1e-13, rule, 100000, threads, batch);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << std::setw(7) << threads
+                  << "  " << std::setw(5) << batch
+                  << "  " << std::setw(10) << r.intervals
+                  << "  " << std::setw(12) << r.evaluations
+                  << "  " << std::setw(9) << t
+                  << "  " << std::setprecision(17) << r.result << std::setprecision(4) << "\n";
+    };
+
+    row(1, 1);
+    for (int threads = 1; threads <= njobs; threads *= 2) {
+        row(threads, 4 * njobs);
+    }
+}
+
+// Sum terms of mixed sign and magnitude, like the estimates of the
+// subintervals of a hard integral, in several orders.
+void bench03(){
+
+    std::cout << "\nBENCH03: naive vs compensated summation (kronrod_sum)\n\n";
+    std::cout << "  terms      naive (s)   kronrod_sum (s)   naive error   kronrod_sum error   naive spread   kronrod_sum spread\n";
+
+    std::mt19937_64 gen(2026);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+
+    for (int m = 1000; m <= 10000000; m *= 100) {
+        std::vector<double> terms(m);
+        for (double& t : terms) {
+            t = u(gen) * std::pow(10.0, 8.0 * u(gen));
+        }
+
+        cpp_bin_float_50 exact = 0;
+        for (double t : terms) {
+            exact += t;
+        }
+
+        double t_naive = 0.0;
+        double t_comp = 0.0;
+        double naive_min = 0.0, naive_max = 0.0, comp_min = 0.0, comp_max = 0.0;
+        double naive_err = 0.0, comp_err = 0.0;
+
+        for (int order = 0; order < 5; order++) {
+            if (order > 0) {
+                std::shuffle(terms.begin(), terms.end(), gen);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            double naive = 0.0;
+            for (double t : terms) {
+                naive += t;
+            }
+            t_naive += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            kronrod_sum<double> sum;
+            for (double t : terms) {
+                sum.add(t);
+            }
+            double comp = sum.value();
+            t_comp += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            naive_min = order == 0 ? naive : std::min(naive_min, naive);
+            naive_max = order == 0 ? naive : std::max(naive_max, naive);
+            comp_min = order == 0 ? comp : std::min(comp_min, comp);
+            comp_max = order == 0 ? comp : std::max(comp_max, comp);
+            naive_err = std::max(naive_err, std::fabs(static_cast<double>(cpp_bin_float_50(naive) - exact)));
+            comp_err = std::max(comp_err, std::fabs(static_cast<double>(cpp_bin_float_50(comp) - exact)));
+        }
+
+        std::cout << "  " << std::setw(8) << m
+                  << "  " << std::setw(11) << t_naive / 5
+                  << "  " << std::setw(16) << t_comp / 5
+                  << "  " << std::setw(12) << naive_err
+                  << "  " << std::setw(18) << comp_err
+                  << "  " << std::setw(13) << naive_max - naive_min
+                  << "  " << std::setw(19) << comp_max - comp_min << "\n";
+    }
+}
+
+// Apply rules of high order to a cheap integrand with plain and with
+// compensated sums.
+void bench04(){
+
+    std::cout << "\nBENCH04: kronrod_qk with plain vs compensated sums, f = cos\n\n";
+    std::cout << "      N   reps   plain (s)   compensated (s)   ratio\n";
+
+    auto f = [](double x){ return std::cos(x); };
+
+    for (int n : {15, 100, 1000, 4000}) {
+        kronrod_rule<double> rule(n);
+        int reps = 4000000 / n;
+        double sink = 0.0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            sink += kronrod_qk(rule, f, 0.0, 1.0 + r * 1e-9).result;
+        }
+        double t_plain = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            sink += kronrod_qk(rule, f, 0.0, 1.0 + r * 1e-9, kronrod_accumulation::compensated).result;
+        }
+        double t_comp = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "  " << std::setw(5) << n
+                  << "  " << std::setw(5) << reps
+                  << "  " << std::setw(10) << t_plain
+                  << "  " << std::setw(16) << t_comp
+                  << "  " << std::setw(6) << t_comp / t_plain
+                  << (sink == 0.0 ? " " : "") << "\n";
+    }
+}
+
+// Apply a rule to many short intervals, one at a time with kronrod_qk
+// and in blocks with kronrod_qk_batch, in double and in float.
+template <typename FloatingPointType>
+double bench_batch(int n, int count, int reps, bool batch){
+
+    kronrod_rule<FloatingPointType> rule(n);
+    std::vector<FloatingPointType> a(count), b(count);
+    std::vector<kronrod_interval<FloatingPointType>> value(count);
+    for (int k = 0; k < count; k++) {
+        a[k] = FloatingPointType(k) / FloatingPointType(count);
+        b[k] = FloatingPointType(k + 1) / FloatingPointType(count);
+    }
+    auto f = [](FloatingPointType x){ return FloatingPointType(1) / (FloatingPointType(1) + x * x) + x * x * x; };
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        if (batch) {
+            kronrod_qk_batch(rule, f, a.data(), b.data(), count, value.data());
+        }
+        else {
+            for (int k = 0; k < count; k++) {
+                value[k] = kronrod_qk(rule, f, a[k], b[k]);
+            }
+        }
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench05(){
+
+    std::cout << "\nBENCH05: kronrod_qk vs kronrod_qk_batch, double vs float, 65536 intervals\n\n";
+    std::cout << "      N   qk double (s)   batch double (s)   batch float (s)   float speedup\n";
+
+    for (int n : {5, 10, 20}) {
+        int reps = 200 / n;
+        double t_qk = bench_batch<double>(n, 65536, reps, false);
+        double t_d = bench_batch<double>(n, 65536, reps, true);
+        double t_f = bench_batch<float>(n, 65536, reps, true);
+        std::cout << "  " << std::setw(5) << n
+                  << "  " << std::setw(14) << t_qk
+                  << "  " << std::setw(17) << t_d
+                  << "  " << std::setw(16) << t_f
+                  << "  " << std::setw(14) << t_d / t_f << "\n";
+    }
+}
+
+void bench06(){
+
+    std::cout << "\nBENCH06: kronrod_rule<double> construction, tabled at build time vs generated\n\n";
+#ifdef KRONROD_HAVE_TABLES
+    std::cout << "      N   kronrod_rule (us)   kronrod<double> (us)\n";
+
+    for (int n : {7, 15, 30}) {
+        int reps = 1000;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            kronrod_rule<double> rule(n);
+        }
+        double t_table = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            auto rule = kronrod<double>(n);
+        }
+        double t_gen = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << std::setw(5) << n
+                  << "  " << std::setw(18) << 1.0e6 * t_table / reps
+                  << "  " << std::setw(21) << 1.0e6 * t_gen / reps << "\n";
+    }
+#else
+    std::cout << "  Not built with KRONROD_HAVE_TABLES.\n";
+#endif
+}
+
+int main(int argc, char** argv) {
+
+    int njobs = argc > 1 ? std::stoi(argv[1]) : 20;
+
+    std::cout << std::setprecision(4);
+
+    bench01(njobs);
+    bench02(njobs);
+    bench03();
+    bench04();
+    bench05();
+    bench06();
+}
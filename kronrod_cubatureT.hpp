@@ -0,0 +1,643 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <iostream>
+
+#include "kronrod_integrateT.hpp"
+
+template <typename FloatingPoint>
+struct kronrod_tensor_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TENSOR_RULE is the tensor product of a Gauss-Kronrod rule.
+//
+//  Discussion:
+//
+//    In DIM dimensions the rule has (2*N+1)^DIM points in [-1,+1]^DIM.
+//    U holds their coordinates, point after point.  WK is the product of
+//    the Gauss-Kronrod weights, and WL that of the Gauss weights, which is
+//    zero unless every coordinate is a Gauss abscissa.
+//
+//    WD[P*DIM+J] is the weight of point P in the rule that is Gauss in
+//    dimension J and Gauss-Kronrod in the others, subtracted from WK[P].
+//    Applied to the function values, it estimates the part of the error
+//    due to dimension J, which is the one KRONROD_HCUBATURE should split.
+//
+//    The number of points grows quickly with DIM, so this rule is meant
+//    for 2 or 3 dimensions.  KRONROD_GENZ_MALIK_RULE scales better.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int dim;
+  int size;
+  std::vector<FloatingPoint> u;
+  std::vector<FloatingPoint> wk;
+  std::vector<FloatingPoint> wl;
+  std::vector<FloatingPoint> wd;
+
+  kronrod_tensor_rule ( const kronrod_rule<FloatingPoint>& rule, int dim ) : dim ( dim )
+  {
+    int n = rule.n;
+    int m = 2 * n + 1;
+//
+//  The one dimensional rule, with all its abscissas.
+//
+    std::vector<FloatingPoint> x1 ( m );
+    std::vector<FloatingPoint> k1 ( m );
+    std::vector<FloatingPoint> g1 ( m );
+    for ( int i = 0; i < n; i++ )
+    {
+      x1[2*i] = - rule.x[i];
+      x1[2*i+1] = rule.x[i];
+      k1[2*i] = k1[2*i+1] = rule.w1[i];
+      g1[2*i] = g1[2*i+1] = rule.w2[i];
+    }
+    x1[2*n] = rule.x[n];
+    k1[2*n] = rule.w1[n];
+    g1[2*n] = rule.w2[n];
+
+    size = 1;
+    for ( int j = 0; j < dim; j++ )
+    {
+      size = size * m;
+    }
+
+    u.resize ( size * dim );
+    wk.resize ( size );
+    wl.resize ( size );
+    wd.resize ( size * dim );
+
+    std::vector<int> index ( dim );
+    for ( int p = 0; p < size; p++ )
+    {
+      int q = p;
+      wk[p] = FloatingPoint ( 1 );
+      wl[p] = FloatingPoint ( 1 );
+      for ( int j = 0; j < dim; j++ )
+      {
+        index[j] = q % m;
+        q = q / m;
+        u[p*dim+j] = x1[index[j]];
+        wk[p] = wk[p] * k1[index[j]];
+        wl[p] = wl[p] * g1[index[j]];
+      }
+      for ( int j = 0; j < dim; j++ )
+      {
+        FloatingPoint w = k1[index[j]] - g1[index[j]];
+        for ( int i = 0; i < dim; i++ )
+        {
+          if ( i != j )
+          {
+            w = w * k1[index[i]];
+          }
+        }
+        wd[p*dim+j] = w;
+      }
+    }
+  }
+
+  int split ( std::span<const FloatingPoint> half,
+    std::span<const FloatingPoint> fx ) const
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    int best = 0;
+    FloatingPoint best_error = FloatingPoint ( -1 );
+
+    for ( int j = 0; j < dim; j++ )
+    {
+      FloatingPoint e = FloatingPoint ( 0 );
+      for ( int p = 0; p < size; p++ )
+      {
+        e = e + wd[p*dim+j] * fx[p];
+      }
+      e = scalar::abs ( e );
+      if ( best_error < e || ( e == best_error && half[best] < half[j] ) )
+      {
+        best = j;
+        best_error = e;
+      }
+    }
+    return best;
+  }
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_genz_malik_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_GENZ_MALIK_RULE is the Genz-Malik rule of degree 7.
+//
+//  Discussion:
+//
+//    The rule has 2^DIM + 2*DIM^2 + 2*DIM + 1 points in [-1,+1]^DIM, and
+//    an embedded rule of degree 5 that uses all but the 2^DIM corners.
+//    WK and WL are their weights, scaled to sum to 2^DIM, as those of
+//    KRONROD_TENSOR_RULE.
+//
+//    The points are stored in the order
+//    the center,
+//    -L2, +L2, -L4, +L4 along each axis in turn,
+//    the four points ( +-L4, +-L4 ) in each pair of axes,
+//    the corners ( +-L5, ..., +-L5 ),
+//    where L2 = sqrt(9/70), L4 = sqrt(9/10) and L5 = sqrt(9/19).
+//
+//    The dimension to split is the one along which the fourth divided
+//    difference of the function values is largest.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Alan Genz, Aftab Malik,
+//    An adaptive algorithm for numerical integration over an
+//    N-dimensional rectangular region,
+//    Journal of Computational and Applied Mathematics,
+//    Volume 6, Number 4, 1980, pages 295-302.
+//
+//    Jarle Berntsen, Terje Espelid, Alan Genz,
+//    An adaptive algorithm for the approximate calculation of multiple
+//    integrals,
+//    ACM Transactions on Mathematical Software,
+//    Volume 17, Number 4, 1991, pages 437-451.
+//
+{
+  int dim;
+  int size;
+  std::vector<FloatingPoint> u;
+  std::vector<FloatingPoint> wk;
+  std::vector<FloatingPoint> wl;
+
+  explicit kronrod_genz_malik_rule ( int dim ) : dim ( dim )
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    if ( dim < 2 )
+    {
+      std::cout << "\n";
+      std::cout << "KRONROD_GENZ_MALIK_RULE - Fatal error!\n";
+      std::cout << "  The dimension must be at least 2.\n";
+      exit ( 1 );
+    }
+
+    FloatingPoint d = FloatingPoint ( dim );
+    FloatingPoint l2 = scalar::sqrt ( FloatingPoint ( 9 ) / FloatingPoint ( 70 ) );
+    FloatingPoint l4 = scalar::sqrt ( FloatingPoint ( 9 ) / FloatingPoint ( 10 ) );
+    FloatingPoint l5 = scalar::sqrt ( FloatingPoint ( 9 ) / FloatingPoint ( 19 ) );
+    FloatingPoint volume = FloatingPoint ( 1 << dim );
+//
+//  The weights of the rule of degree 7, and of the embedded rule, for a
+//  region of unit volume.
+//
+    FloatingPoint w1 = ( FloatingPoint ( 12824 ) - FloatingPoint ( 9120 ) * d
+      + FloatingPoint ( 400 ) * d * d ) / FloatingPoint ( 19683 );
+    FloatingPoint w2 = FloatingPoint ( 980 ) / FloatingPoint ( 6561 );
+    FloatingPoint w3 = ( FloatingPoint ( 1820 ) - FloatingPoint ( 400 ) * d )
+      / FloatingPoint ( 19683 );
+    FloatingPoint w4 = FloatingPoint ( 200 ) / FloatingPoint ( 19683 );
+    FloatingPoint w5 = FloatingPoint ( 6859 ) / FloatingPoint ( 19683 ) / volume;
+
+    FloatingPoint e1 = ( FloatingPoint ( 729 ) - FloatingPoint ( 950 ) * d
+      + FloatingPoint ( 50 ) * d * d ) / FloatingPoint ( 729 );
+    FloatingPoint e2 = FloatingPoint ( 245 ) / FloatingPoint ( 486 );
+    FloatingPoint e3 = ( FloatingPoint ( 265 ) - FloatingPoint ( 100 ) * d )
+      / FloatingPoint ( 1458 );
+    FloatingPoint e4 = FloatingPoint ( 25 ) / FloatingPoint ( 729 );
+
+    size = ( 1 << dim ) + 2 * dim * dim + 2 * dim + 1;
+    u.assign ( size * dim, FloatingPoint ( 0 ) );
+    wk.resize ( size );
+    wl.resize ( size );
+
+    int p = 0;
+    wk[p] = w1;
+    wl[p] = e1;
+    p = p + 1;
+
+    for ( int i = 0; i < dim; i++ )
+    {
+      FloatingPoint l[4] = { - l2, l2, - l4, l4 };
+      for ( int k = 0; k < 4; k++ )
+      {
+        u[p*dim+i] = l[k];
+        wk[p] = ( k < 2 ) ? w2 : w3;
+        wl[p] = ( k < 2 ) ? e2 : e3;
+        p = p + 1;
+      }
+    }
+
+    for ( int i = 0; i < dim; i++ )
+    {
+      for ( int j = i + 1; j < dim; j++ )
+      {
+        for ( int k = 0; k < 4; k++ )
+        {
+          u[p*dim+i] = ( k % 2 == 0 ) ? - l4 : l4;
+          u[p*dim+j] = ( k / 2 == 0 ) ? - l4 : l4;
+          wk[p] = w4;
+          wl[p] = e4;
+          p = p + 1;
+        }
+      }
+    }
+
+    for ( int k = 0; k < ( 1 << dim ); k++ )
+    {
+      for ( int i = 0; i < dim; i++ )
+      {
+        u[p*dim+i] = ( ( k >> i ) & 1 ) ? l5 : - l5;
+      }
+      wk[p] = w5;
+      wl[p] = FloatingPoint ( 0 );
+      p = p + 1;
+    }
+
+    for ( p = 0; p < size; p++ )
+    {
+      wk[p] = wk[p] * volume;
+      wl[p] = wl[p] * volume;
+    }
+  }
+
+  int split ( std::span<const FloatingPoint> half,
+    std::span<const FloatingPoint> fx ) const
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    FloatingPoint ratio = FloatingPoint ( 9 ) / FloatingPoint ( 70 )
+      / ( FloatingPoint ( 9 ) / FloatingPoint ( 10 ) );
+    FloatingPoint f0 = FloatingPoint ( 2 ) * fx[0];
+    int best = 0;
+    FloatingPoint best_diff = FloatingPoint ( -1 );
+
+    for ( int i = 0; i < dim; i++ )
+    {
+      int k = 1 + 4 * i;
+      FloatingPoint diff = scalar::abs ( fx[k] + fx[k+1] - f0
+        - ratio * ( fx[k+2] + fx[k+3] - f0 ) );
+      if ( best_diff < diff || ( diff == best_diff && half[best] < half[i] ) )
+      {
+        best = i;
+        best_diff = diff;
+      }
+    }
+    return best;
+  }
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_region
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_REGION is a box with its integral and error estimates.
+//
+//  Discussion:
+//
+//    The box is CENTER +- HALF.  SPLIT is the dimension along which it
+//    should be bisected.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  std::vector<FloatingPoint> center;
+  std::vector<FloatingPoint> half;
+  FloatingPoint result;
+  FloatingPoint error;
+  int split;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Rule, typename Function>
+void kronrod_region_apply ( const Rule& rule, Function& f,
+  std::span<kronrod_region<FloatingPoint>> regions, std::vector<FloatingPoint>& x,
+  std::vector<FloatingPoint>& fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_REGION_APPLY applies a cubature rule to several regions.
+//
+//  Discussion:
+//
+//    The points of all the regions are passed to F in a single call, so
+//    that F may vectorize or parallelize its work.
+//
+//    The error estimate is the difference of the two rules, without the
+//    rescaling that KRONROD_QK applies in one dimension.
+//
+//    X and FX are the caller's storage for the points and values, which
+//    KRONROD_HCUBATURE keeps for the whole of one integration, so that F
+//    may start integrations of its own.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Rule RULE, the cubature rule.
+//
+//    Input, Function &F, the batch integrand.
+//
+//    Input/output, kronrod_region<FloatingPoint> REGIONS[], the regions,
+//    given CENTER and HALF.  On output, their estimates are set.
+//
+//    Workspace, std::vector<FloatingPoint>& X, FX, resized as needed.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  int dim = rule.dim;
+  int size = rule.size;
+  int count = int ( regions.size ( ) );
+
+  x.resize ( count * size * dim );
+  fx.resize ( count * size );
+
+  for ( int r = 0; r < count; r++ )
+  {
+    const kronrod_region<FloatingPoint>& region = regions[r];
+    FloatingPoint *xr = x.data ( ) + r * size * dim;
+    for ( int p = 0; p < size; p++ )
+    {
+      for ( int j = 0; j < dim; j++ )
+      {
+        xr[p*dim+j] = region.center[j] + region.half[j] * rule.u[p*dim+j];
+      }
+    }
+  }
+
+  f ( std::span<const FloatingPoint> ( x.data ( ), x.size ( ) ),
+    std::span<FloatingPoint> ( fx.data ( ), fx.size ( ) ) );
+
+  for ( int r = 0; r < count; r++ )
+  {
+    kronrod_region<FloatingPoint>& region = regions[r];
+    std::span<const FloatingPoint> fr ( fx.data ( ) + r * size, size );
+
+    FloatingPoint volume = FloatingPoint ( 1 );
+    for ( int j = 0; j < dim; j++ )
+    {
+      volume = volume * region.half[j];
+    }
+
+    FloatingPoint high = FloatingPoint ( 0 );
+    FloatingPoint low = FloatingPoint ( 0 );
+    for ( int p = 0; p < size; p++ )
+    {
+      high = high + rule.wk[p] * fr[p];
+      low = low + rule.wl[p] * fr[p];
+    }
+
+    region.result = high * volume;
+    region.error = scalar::abs ( ( high - low ) * volume );
+    region.split = rule.split ( region.half, fr );
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+auto kronrod_batch ( Function f, int dim )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_BATCH turns an integrand of one point into a batch integrand.
+//
+//  Discussion:
+//
+//    F is called as F ( X ), where X is a std::span of DIM coordinates.
+//    The batch integrand is called as G ( X, FX ), where X holds the
+//    coordinates of FX.size() points, point after point.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  return [f, dim] ( std::span<const FloatingPoint> x, std::span<FloatingPoint> fx ) mutable
+  {
+    for ( std::size_t p = 0; p < fx.size ( ); p++ )
+    {
+      fx[p] = f ( x.subspan ( p * dim, dim ) );
+    }
+  };
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Rule, typename Function>
+kronrod_result<FloatingPoint> kronrod_hcubature ( Function f,
+  std::span<const FloatingPoint> a, std::span<const FloatingPoint> b,
+  FloatingPoint epsabs, FloatingPoint epsrel, const Rule& rule,
+  int limit = 10000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_HCUBATURE integrates F over a box by adaptive subdivision.
+//
+//  Discussion:
+//
+//    The regions are kept in a max-heap ordered by their error estimates,
+//    as the subintervals of KRONROD_INTEGRATE.  The worst region is
+//    bisected along the dimension its rule selected, and RULE is applied
+//    to both halves with one call of F.
+//
+//    RULE is a KRONROD_TENSOR_RULE or a KRONROD_GENZ_MALIK_RULE.  With
+//    LIMIT = 1 this just applies the rule to the box.
+//
+//    F is a batch integrand, called as F ( X, FX ), which must set FX[P]
+//    to the value at the point X[P*DIM], ..., X[P*DIM+DIM-1].
+//    KRONROD_BATCH adapts an integrand of one point.
+//
+//    INTERVALS counts the regions.  IER is 0 if the requested accuracy
+//    was reached, and 1 if the number of regions reached LIMIT.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Jarle Berntsen, Terje Espelid, Alan Genz,
+//    An adaptive algorithm for the approximate calculation of multiple
+//    integrals,
+//    ACM Transactions on Mathematical Software,
+//    Volume 17, Number 4, 1991, pages 437-451.
+//
+//  Parameters:
+//
+//    Input, Function F, the batch integrand.
+//
+//    Input, FloatingPoint A[DIM], B[DIM], the corners of the box.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, Rule RULE, the cubature rule.
+//
+//    Input, int LIMIT, the maximum number of regions.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_HCUBATURE, the
+//    integral and error estimates.
+//
+{
+  typedef kronrod_region<FloatingPoint> region;
+
+  int dim = rule.dim;
+  auto worse = [] ( const region& p, const region& q )
+  {
+    if ( p.error != q.error )
+    {
+      return p.error < q.error;
+    }
+    return std::lexicographical_compare ( q.center.begin ( ), q.center.end ( ),
+      p.center.begin ( ), p.center.end ( ) );
+  };
+  std::vector<region> heap;
+  region halves[2];
+  std::vector<FloatingPoint> x;
+  std::vector<FloatingPoint> fx;
+  kronrod_result<FloatingPoint> value;
+  kronrod_sum<FloatingPoint> total;
+
+  if ( int ( a.size ( ) ) != dim || int ( b.size ( ) ) != dim )
+  {
+    std::cout << "\n";
+    std::cout << "KRONROD_HCUBATURE - Fatal error!\n";
+    std::cout << "  A and B must have the dimension of the rule, " << dim << ".\n";
+    exit ( 1 );
+  }
+
+  heap.resize ( 1 );
+  heap[0].center.resize ( dim );
+  heap[0].half.resize ( dim );
+  for ( int j = 0; j < dim; j++ )
+  {
+    heap[0].center[j] = ( a[j] + b[j] ) / FloatingPoint ( 2 );
+    heap[0].half[j] = ( b[j] - a[j] ) / FloatingPoint ( 2 );
+  }
+  kronrod_region_apply ( rule, f, std::span<region> ( heap ), x, fx );
+
+  total.add ( heap[0].result );
+  value.result = heap[0].result;
+  value.error = heap[0].error;
+  value.evaluations = rule.size;
+  value.intervals = 1;
+  value.ier = 0;
+
+  for ( ; ; )
+  {
+    FloatingPoint tol = std::max ( epsabs,
+      epsrel * kronrod_scalar<FloatingPoint>::abs ( value.result ) );
+
+    if ( value.error <= tol )
+    {
+      break;
+    }
+
+    if ( limit <= value.intervals )
+    {
+      value.ier = 1;
+      break;
+    }
+//
+//  Bisect the worst region along its split dimension.
+//
+    std::pop_heap ( heap.begin ( ), heap.end ( ), worse );
+    region p = std::move ( heap.back ( ) );
+    heap.pop_back ( );
+
+    int j = p.split;
+    for ( int k = 0; k < 2; k++ )
+    {
+      halves[k].center = p.center;
+      halves[k].half = p.half;
+      halves[k].half[j] = p.half[j] / FloatingPoint ( 2 );
+    }
+    halves[0].center[j] = p.center[j] - halves[0].half[j];
+    halves[1].center[j] = p.center[j] + halves[1].half[j];
+
+    kronrod_region_apply ( rule, f, std::span<region> ( halves, 2 ), x, fx );
+
+    total.add ( halves[0].result );
+    total.add ( halves[1].result );
+    total.add ( - p.result );
+    value.result = total.value ( );
+    value.error = value.error + ( ( halves[0].error + halves[1].error ) - p.error );
+
+    for ( int k = 0; k < 2; k++ )
+    {
+      heap.push_back ( halves[k] );
+      std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+    }
+
+    value.evaluations = value.evaluations + 2 * rule.size;
+    value.intervals = value.intervals + 1;
+  }
+//
+//  Sum the final estimates again, to remove the drift of the updates.
+//
+  std::sort ( heap.begin ( ), heap.end ( ),
+    [] ( const region& p, const region& q ) { return std::lexicographical_compare (
+    p.center.begin ( ), p.center.end ( ), q.center.begin ( ), q.center.end ( ) ); } );
+  kronrod_sum<FloatingPoint> sum;
+  value.error = FloatingPoint ( 0 );
+  for ( const region& p : heap )
+  {
+    sum.add ( p.result );
+    value.error = value.error + p.error;
+  }
+  value.result = sum.value ( );
+
+  return value;
+}
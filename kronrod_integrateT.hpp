@@ -0,0 +1,919 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <type_traits>
+
+#include "kronrodT.hpp"
+#ifdef KRONROD_HAVE_TABLES
+#include "kronrod_tables.hpp"
+#endif
+
+template <typename FloatingPoint>
+struct kronrod_generation
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_GENERATION names the type in which KRONROD_RULE generates a rule.
+//
+//  Discussion:
+//
+//    The rules are generated in the working precision, except for float.
+//    Newton's method in float leaves abscissas and weights that are off
+//    by hundreds of units in the last place at N = 10, and by far more
+//    for larger N, while the rule generated in double and rounded is
+//    correct to half a unit.  Other types may be given the
+//    same treatment by specializing this structure.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  typedef FloatingPoint type;
+};
+
+template <>
+struct kronrod_generation<float>
+{
+  typedef double type;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_RULE holds a Gauss-Kronrod rule on [-1,+1] for reuse.
+//
+//  Discussion:
+//
+//    The arrays are those of KRONROD: the nonnegative abscissas in
+//    decreasing order, with X[N] = 0, and the Gauss-Kronrod and Gauss
+//    weights.
+//
+//    The rule is generated in KRONROD_GENERATION<FloatingPoint>::TYPE and
+//    rounded.  A rule in one type may also be rounded from a rule in
+//    another.  With KRONROD_HAVE_TABLES, the rules in double of the
+//    orders that were tabled at build time are copied from KRONROD_TABLE.
+//
+//    Other nested pairs with the same layout, such as those of
+//    KRONROD_PATTERSON and KRONROD_LOBATTO, are filled into a default
+//    constructed rule.  N is then the number of positive abscissas, so
+//    that a rule always takes 2*N+1 values of F.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int n;
+  std::vector<FloatingPoint> x;
+  std::vector<FloatingPoint> w1;
+  std::vector<FloatingPoint> w2;
+
+  kronrod_rule ( ) : n ( 0 )
+  {
+  }
+
+  explicit kronrod_rule ( int n ) : n ( n )
+  {
+    typedef typename kronrod_generation<FloatingPoint>::type work;
+
+#ifdef KRONROD_HAVE_TABLES
+    if constexpr ( std::is_same<FloatingPoint, double>::value )
+    {
+      if ( const kronrod_table* table = kronrod_table_find ( n ) )
+      {
+        x.assign ( table->x, table->x + n + 1 );
+        w1.assign ( table->w1, table->w1 + n + 1 );
+        w2.assign ( table->w2, table->w2 + n + 1 );
+        return;
+      }
+    }
+#endif
+    if constexpr ( std::is_same<work, FloatingPoint>::value )
+    {
+      std::tie ( x, w1, w2 ) = kronrod<FloatingPoint> ( n );
+    }
+    else
+    {
+      *this = kronrod_rule ( kronrod_rule<work> ( n ) );
+    }
+  }
+
+  template <typename Other>
+  explicit kronrod_rule ( const kronrod_rule<Other>& rule ) : n ( rule.n )
+  {
+    x.resize ( n + 1 );
+    w1.resize ( n + 1 );
+    w2.resize ( n + 1 );
+    for ( int i = 0; i <= n; i++ )
+    {
+      x[i] = static_cast<FloatingPoint> ( rule.x[i] );
+      w1[i] = static_cast<FloatingPoint> ( rule.w1[i] );
+      w2[i] = static_cast<FloatingPoint> ( rule.w2[i] );
+    }
+  }
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+class kronrod_rule_cache
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_RULE_CACHE generates each rule once and keeps it.
+//
+//  Discussion:
+//
+//    GET may be called from several threads.  The rules are never moved
+//    once generated, so the references it returns stay valid for the
+//    life of the cache.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  const kronrod_rule<FloatingPoint>& get ( int n )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+
+    std::unique_ptr<kronrod_rule<FloatingPoint>>& rule = rules[n];
+    if ( !rule )
+    {
+      rule = std::make_unique<kronrod_rule<FloatingPoint>> ( n );
+    }
+    return *rule;
+  }
+
+private:
+
+  std::mutex mtx;
+  std::map<int, std::unique_ptr<kronrod_rule<FloatingPoint>>> rules;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_interval
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTERVAL is a subinterval with its integral and error estimates.
+//
+//  Discussion:
+//
+//    RESABS approximates the integral of |F|, and RESASC the integral of
+//    |F - I/(B-A)|, where I is RESULT.  They are used as in QUADPACK.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  FloatingPoint a;
+  FloatingPoint b;
+  FloatingPoint result;
+  FloatingPoint error;
+  FloatingPoint resabs;
+  FloatingPoint resasc;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_worse
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_WORSE orders intervals for a max-heap on the error estimate.
+//
+//  Discussion:
+//
+//    Ties are broken by the left end, so that the order in which intervals
+//    are taken from the heap does not depend on how they were inserted.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  bool operator() ( const kronrod_interval<FloatingPoint>& p,
+    const kronrod_interval<FloatingPoint>& q ) const
+  {
+    if ( p.error != q.error )
+    {
+      return p.error < q.error;
+    }
+    return q.a < p.a;
+  }
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_result
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_RESULT is what the integrators return.
+//
+//  Discussion:
+//
+//    IER follows QUADPACK:
+//    0, the requested accuracy was reached;
+//    1, the maximum number of subintervals was reached.
+//
+//    KRONROD_QAGS may also return the codes 2 to 6 of QUADPACK's QAGS.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  FloatingPoint result;
+  FloatingPoint error;
+  int evaluations;
+  int intervals;
+  int ier;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+class kronrod_sum
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_SUM accumulates a sum with Neumaier's compensation.
+//
+//  Discussion:
+//
+//    The rounding error of each addition is computed exactly, since
+//    |S| >= |X| implies that ( S - ( S + X ) ) + X is exact, and is
+//    collected in a separate correction.  VALUE returns the sum plus the
+//    correction.  The error is then that of summing in twice the
+//    precision, about EPSILON * |sum|, instead of growing with the number
+//    of terms and depending on their order.
+//
+//    This relies on strict IEEE arithmetic, and is defeated by options
+//    such as -ffast-math that allow reassociation.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Arnold Neumaier,
+//    Rundungsfehleranalyse einiger Verfahren zur Summation endlicher
+//    Summen,
+//    Zeitschrift fuer Angewandte Mathematik und Mechanik,
+//    Volume 54, 1974, pages 39-51.
+//
+{
+public:
+
+  void add ( const FloatingPoint& x )
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    FloatingPoint t = s + x;
+    if ( scalar::abs ( x ) <= scalar::abs ( s ) )
+    {
+      c = c + ( ( s - t ) + x );
+    }
+    else
+    {
+      c = c + ( ( x - t ) + s );
+    }
+    s = t;
+  }
+
+  FloatingPoint value ( ) const
+  {
+    return s + c;
+  }
+
+private:
+
+  FloatingPoint s = FloatingPoint ( 0 );
+  FloatingPoint c = FloatingPoint ( 0 );
+};
+//****************************************************************************80
+
+enum class kronrod_accumulation
+{
+  plain,
+  compensated
+};
+
+#if defined ( FP_FAST_FMA )
+#define KRONROD_FAST_FMA 1
+#else
+#define KRONROD_FAST_FMA 0
+#endif
+
+template <typename FloatingPoint>
+inline void kronrod_two_product ( const FloatingPoint& a, const FloatingPoint& b,
+  FloatingPoint& h, FloatingPoint& r )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TWO_PRODUCT splits A*B into its rounded value and its error.
+//
+//  Discussion:
+//
+//    H = fl(A*B) and R = A*B - H exactly.  R comes from a fused
+//    multiply-add where the hardware has one.  Otherwise, for the built-in
+//    types, it comes from Veltkamp's splitting of A and B into halves whose
+//    products are exact, which is a few more operations but vectorizes,
+//    where a call to a software FMA would not.  Other types use their FMA.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Theodorus Dekker,
+//    A Floating-Point Technique for Extending the Available Precision,
+//    Numerische Mathematik,
+//    Volume 18, 1971, pages 224-242.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  h = a * b;
+
+  if constexpr ( std::is_floating_point<FloatingPoint>::value && !KRONROD_FAST_FMA )
+  {
+    const FloatingPoint factor = FloatingPoint ( ( 1LL << ( ( scalar::digits ( ) + 1 ) / 2 ) ) + 1 );
+    FloatingPoint c = factor * a;
+    FloatingPoint ah = c - ( c - a );
+    FloatingPoint al = a - ah;
+    c = factor * b;
+    FloatingPoint bh = c - ( c - b );
+    FloatingPoint bl = b - bh;
+    r = ( ( ( ah * bh - h ) + ah * bl ) + al * bh ) + al * bl;
+  }
+  else
+  {
+    r = scalar::fma ( a, b, FloatingPoint ( - h ) );
+  }
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+FloatingPoint kronrod_dot2 ( const FloatingPoint w[], const FloatingPoint fv[], int n )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_DOT2 applies weights to function values in twice the working
+//    precision.
+//
+//  Discussion:
+//
+//    The value is
+//      W[N] * FV[2*N] + sum ( 0 <= I < N ) W[I] * ( FV[2*I] + FV[2*I+1] ),
+//    with FV laid out as for KRONROD_QK_SUMS.  Every product and sum is
+//    split into its rounded value and its error, and the errors are
+//    summed separately, as in the algorithm Dot2 of Ogita, Rump and
+//    Oishi.  The result is as accurate as if computed in twice the
+//    precision and then rounded, so its error no longer grows with N.
+//
+//    The terms are spread over 4 independent accumulators, combined at
+//    the end, so that the compiler can keep them in one SIMD register.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Takeshi Ogita, Siegfried Rump, Shin'ichi Oishi,
+//    Accurate Sum and Dot Product,
+//    SIAM Journal on Scientific Computing,
+//    Volume 26, Number 6, 2005, pages 1955-1988.
+//
+//  Parameters:
+//
+//    Input, FloatingPoint W[N+1], the weights.
+//
+//    Input, FloatingPoint FV[2*N+1], the function values.
+//
+//    Input, int N, the number of pairs.
+//
+//    Output, FloatingPoint KRONROD_DOT2, the weighted sum.
+//
+{
+  const int lanes = 4;
+  FloatingPoint p[lanes];
+  FloatingPoint s[lanes];
+
+  auto add = [] ( FloatingPoint& p, FloatingPoint& s, const FloatingPoint& h,
+    const FloatingPoint& r )
+  {
+    FloatingPoint t = p + h;
+    FloatingPoint z = t - p;
+    s = s + ( ( ( p - ( t - z ) ) + ( h - z ) ) + r );
+    p = t;
+  };
+//
+//  W * ( U + V ) = W * ( SUM + ERR ), with U + V = SUM + ERR exactly.
+//  W * ERR is only needed to working precision.
+//
+  auto pair = [&add] ( FloatingPoint& p, FloatingPoint& s, const FloatingPoint& w,
+    const FloatingPoint& u, const FloatingPoint& v )
+  {
+    FloatingPoint sum = u + v;
+    FloatingPoint z = sum - u;
+    FloatingPoint err = ( u - ( sum - z ) ) + ( v - z );
+    FloatingPoint h;
+    FloatingPoint r;
+    kronrod_two_product ( w, sum, h, r );
+    add ( p, s, h, FloatingPoint ( r + w * err ) );
+  };
+
+  for ( int k = 0; k < lanes; k++ )
+  {
+    p[k] = FloatingPoint ( 0 );
+    s[k] = FloatingPoint ( 0 );
+  }
+
+  int i = 0;
+  for ( ; i + lanes <= n; i = i + lanes )
+  {
+    for ( int k = 0; k < lanes; k++ )
+    {
+      pair ( p[k], s[k], w[i+k], fv[2*(i+k)], fv[2*(i+k)+1] );
+    }
+  }
+  for ( ; i < n; i++ )
+  {
+    pair ( p[0], s[0], w[i], fv[2*i], fv[2*i+1] );
+  }
+  {
+    FloatingPoint h;
+    FloatingPoint r;
+    kronrod_two_product ( w[n], fv[2*n], h, r );
+    add ( p[0], s[0], h, r );
+  }
+
+  for ( int k = 1; k < lanes; k++ )
+  {
+    add ( p[0], s[0], p[k], s[k] );
+  }
+
+  return p[0] + s[0];
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+kronrod_interval<FloatingPoint> kronrod_qk_estimate ( const FloatingPoint& a,
+  const FloatingPoint& b, const FloatingPoint& i1, const FloatingPoint& i2,
+  const FloatingPoint& resabs, const FloatingPoint& resasc )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_ESTIMATE scales the sums of a rule on [-1,+1] to [A,B].
+//
+//  Discussion:
+//
+//    I1 and I2 are the Gauss-Kronrod and Gauss sums, RESABS and RESASC
+//    the sums for the integrals of |F| and |F - I1/2|, all on [-1,+1].
+//    The error estimate is that of KRONROD_QK_SUMS.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint I1, I2, RESABS, RESASC, the sums.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK_ESTIMATE, the
+//    interval with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+  FloatingPoint dhalf = scalar::abs ( half );
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint uflow = scalar::min ( );
+
+  kronrod_interval<FloatingPoint> value;
+  value.a = a;
+  value.b = b;
+  value.result = i1 * half;
+  value.resabs = resabs * dhalf;
+  value.resasc = resasc * dhalf;
+  value.error = scalar::abs ( ( i1 - i2 ) * half );
+
+  if ( value.resasc != FloatingPoint ( 0 ) && value.error != FloatingPoint ( 0 ) )
+  {
+    FloatingPoint r = FloatingPoint ( 200 ) * value.error / value.resasc;
+    value.error = value.resasc * std::min ( FloatingPoint ( 1 ), FloatingPoint ( r * scalar::sqrt ( r ) ) );
+  }
+  if ( uflow / ( FloatingPoint ( 50 ) * epmach ) < value.resabs )
+  {
+    value.error = std::max ( FloatingPoint ( epmach * FloatingPoint ( 50 ) * value.resabs ), value.error );
+  }
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+kronrod_interval<FloatingPoint> kronrod_qk_sums ( const kronrod_rule<FloatingPoint>& rule,
+  const std::vector<FloatingPoint>& fv, const FloatingPoint& a, const FloatingPoint& b,
+  kronrod_accumulation accumulation = kronrod_accumulation::plain )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_SUMS forms the estimates of KRONROD_QK from function values.
+//
+//  Discussion:
+//
+//    FV[2*I] and FV[2*I+1] are the values at the abscissas left and right
+//    of the center that correspond to X[I], and FV[2*N] is the value at
+//    the center.
+//
+//    The error estimate is the one of QUADPACK's QK routines: the
+//    difference E between the Gauss-Kronrod and Gauss results is scaled
+//    to RESASC * min ( 1, ( 200 E / RESASC )^1.5 ), which is pessimistic
+//    for small differences, and is not allowed to fall below the roundoff
+//    level 50 * EPSILON * RESABS.
+//
+//    With KRONROD_ACCUMULATION::COMPENSATED, the weights are applied by
+//    KRONROD_DOT2.  The rounding error of the sums then stays at the level
+//    of one rounding instead of growing with N, which matters for rules
+//    with N in the hundreds or more.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, FloatingPoint FV[2*N+1], the function values.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, kronrod_accumulation ACCUMULATION, how to apply the weights.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK_SUMS, the interval
+//    with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  int n = rule.n;
+
+  FloatingPoint fc = fv[2*n];
+  FloatingPoint i1;
+  FloatingPoint i2;
+  FloatingPoint resabs = rule.w1[n] * scalar::abs ( fc );
+
+  if ( accumulation == kronrod_accumulation::compensated )
+  {
+    i1 = kronrod_dot2 ( rule.w1.data ( ), fv.data ( ), n );
+    i2 = kronrod_dot2 ( rule.w2.data ( ), fv.data ( ), n );
+    for ( int i = 0; i < n; i++ )
+    {
+      resabs = resabs + rule.w1[i] * ( scalar::abs ( fv[2*i] ) + scalar::abs ( fv[2*i+1] ) );
+    }
+  }
+  else
+  {
+    i1 = rule.w1[n] * fc;
+    i2 = rule.w2[n] * fc;
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint fsum = fv[2*i] + fv[2*i+1];
+      i1 = i1 + rule.w1[i] * fsum;
+      i2 = i2 + rule.w2[i] * fsum;
+      resabs = resabs + rule.w1[i] * ( scalar::abs ( fv[2*i] ) + scalar::abs ( fv[2*i+1] ) );
+    }
+  }
+
+  FloatingPoint mean = i1 / FloatingPoint ( 2 );
+  FloatingPoint resasc = rule.w1[n] * scalar::abs ( fc - mean );
+  for ( int i = 0; i < n; i++ )
+  {
+    resasc = resasc + rule.w1[i] 
+      * ( scalar::abs ( fv[2*i] - mean ) + scalar::abs ( fv[2*i+1] - mean ) );
+  }
+
+  return kronrod_qk_estimate ( a, b, i1, i2, resabs, resasc );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qk ( const kronrod_rule<FloatingPoint>& rule,
+  Function& f, const FloatingPoint& a, const FloatingPoint& b,
+  kronrod_accumulation accumulation = kronrod_accumulation::plain )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK applies a Gauss-Kronrod rule to F on [A,B].
+//
+//  Discussion:
+//
+//    The rule uses 2*N+1 function values.  The estimates are those of
+//    KRONROD_QK_SUMS.
+//
+//    The values are kept in storage of the call's own, so F may itself
+//    call KRONROD_QK or KRONROD_INTEGRATE, as a nested integral does.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, Function &F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, kronrod_accumulation ACCUMULATION, how to apply the weights.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK, the interval
+//    with its estimates.
+//
+{
+  int n = rule.n;
+  FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+  std::vector<FloatingPoint> fv ( 2 * n + 1 );
+
+  fv[2*n] = f ( center );
+  for ( int i = 0; i < n; i++ )
+  {
+    FloatingPoint dx = half * rule.x[i];
+    fv[2*i] = f ( center - dx );
+    fv[2*i+1] = f ( center + dx );
+  }
+
+  return kronrod_qk_sums ( rule, fv, a, b, accumulation );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit = 1000, int threads = 1,
+  int batch = 1, kronrod_accumulation accumulation = kronrod_accumulation::plain )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE integrates F over [A,B] by adaptive bisection.
+//
+//  Discussion:
+//
+//    The subintervals are kept in a max-heap ordered by their error
+//    estimates.  Each round takes the BATCH worst subintervals, bisects
+//    them, and applies RULE to the 2*BATCH halves.  With BATCH = 1 this
+//    is the usual serial algorithm of QUADPACK's QAG.
+//
+//    The halves of a round are evaluated on THREADS threads, so F must be
+//    safe to call concurrently when THREADS > 1.  Everything else, the
+//    heap and the sums, is handled on the calling thread in a fixed
+//    order.  The result therefore depends on BATCH but not on THREADS,
+//    and is the same from run to run.
+//
+//    The integral is accumulated with KRONROD_SUM, and summed again at
+//    the end over the subintervals sorted from left to right, so that it
+//    carries no rounding error beyond that of the individual estimates.
+//
+//    A BATCH of a few times THREADS keeps the threads busy, at the cost
+//    of some subdivisions that the serial algorithm would not have made.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Input, int THREADS, the number of threads for the integrand.
+//
+//    Input, int BATCH, the number of subintervals bisected per round.
+//
+//    Input, kronrod_accumulation ACCUMULATION, how RULE applies its
+//    weights, see KRONROD_QK_SUMS.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE, the
+//    integral and error estimates.
+//
+{
+  typedef kronrod_interval<FloatingPoint> interval;
+
+  kronrod_worse<FloatingPoint> worse;
+  std::vector<interval> heap;
+  std::vector<interval> parents;
+  std::vector<interval> halves;
+  kronrod_result<FloatingPoint> value;
+  kronrod_sum<FloatingPoint> total;
+  int per_rule = 2 * rule.n + 1;
+
+  batch = std::max ( batch, 1 );
+
+  heap.push_back ( kronrod_qk ( rule, f, a, b, accumulation ) );
+  total.add ( heap[0].result );
+  value.result = heap[0].result;
+  value.error = heap[0].error;
+  value.evaluations = per_rule;
+  value.intervals = 1;
+  value.ier = 0;
+
+  for ( ; ; )
+  {
+    FloatingPoint tol = std::max ( epsabs,
+      epsrel * kronrod_scalar<FloatingPoint>::abs ( value.result ) );
+
+    if ( value.error <= tol )
+    {
+      break;
+    }
+
+    if ( limit <= value.intervals )
+    {
+      value.ier = 1;
+      break;
+    }
+//
+//  Take the worst subintervals off the heap.
+//
+    int count = std::min ( batch, limit - value.intervals );
+
+    parents.clear ( );
+    for ( int i = 0; i < count && !heap.empty ( ); i++ )
+    {
+      std::pop_heap ( heap.begin ( ), heap.end ( ), worse );
+      parents.push_back ( heap.back ( ) );
+      heap.pop_back ( );
+    }
+//
+//  Apply the rule to both halves of each one.
+//
+    halves.resize ( 2 * parents.size ( ) );
+    kronrod_parallel_for ( int ( halves.size ( ) ), threads, [&] ( int i )
+    {
+      const interval& p = parents[i/2];
+      FloatingPoint mid = ( p.a + p.b ) / FloatingPoint ( 2 );
+      if ( i % 2 == 0 )
+      {
+        halves[i] = kronrod_qk ( rule, f, p.a, mid, accumulation );
+      }
+      else
+      {
+        halves[i] = kronrod_qk ( rule, f, mid, p.b, accumulation );
+      }
+    } );
+//
+//  Update the estimates in a fixed order, and put the halves on the heap.
+//
+    for ( std::size_t i = 0; i < parents.size ( ); i++ )
+    {
+      const interval& p = parents[i];
+      const interval& h1 = halves[2*i];
+      const interval& h2 = halves[2*i+1];
+
+      total.add ( h1.result );
+      total.add ( h2.result );
+      total.add ( - p.result );
+      value.error = value.error + ( ( h1.error + h2.error ) - p.error );
+
+      heap.push_back ( h1 );
+      std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+      heap.push_back ( h2 );
+      std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+    }
+
+    value.result = total.value ( );
+    value.evaluations = value.evaluations + per_rule * int ( halves.size ( ) );
+    value.intervals = value.intervals + int ( parents.size ( ) );
+  }
+//
+//  Sum the final estimates again, to remove the drift of the updates.
+//
+  std::sort ( heap.begin ( ), heap.end ( ),
+    [] ( const interval& p, const interval& q ) { return p.a < q.a; } );
+  kronrod_sum<FloatingPoint> sum;
+  value.error = FloatingPoint ( 0 );
+  for ( const interval& p : heap )
+  {
+    sum.add ( p.result );
+    value.error = value.error + p.error;
+  }
+  value.result = sum.value ( );
+
+  return value;
+}
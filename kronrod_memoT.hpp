@@ -0,0 +1,204 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+
+template <typename FloatingPoint>
+std::uint64_t kronrod_memo_hash ( const FloatingPoint& x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_MEMO_HASH hashes the bit pattern of X.
+//
+//  Discussion:
+//
+//    The bytes of X are taken 8 at a time and mixed with the finalizer of
+//    SplitMix64, so that abscissas that differ in their last bits spread
+//    over the whole table.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  unsigned char bytes[sizeof ( FloatingPoint )];
+  std::uint64_t h = 0x9E3779B97F4A7C15ULL;
+
+  std::memcpy ( bytes, &x, sizeof ( FloatingPoint ) );
+  for ( std::size_t i = 0; i < sizeof ( FloatingPoint ); i = i + 8 )
+  {
+    std::uint64_t word = 0;
+    std::memcpy ( &word, bytes + i, std::min ( sizeof ( word ), sizeof ( FloatingPoint ) - i ) );
+    h = h ^ word;
+    h = ( h ^ ( h >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    h = ( h ^ ( h >> 27 ) ) * 0x94D049BB133111EBULL;
+    h = h ^ ( h >> 31 );
+  }
+
+  return h;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+class kronrod_memo
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_MEMO remembers the values of an expensive integrand.
+//
+//  Discussion:
+//
+//    A KRONROD_MEMO is called like F, and can be passed to any of the
+//    integrators in place of F.  Values are kept in an open addressing
+//    hash table of CAPACITY slots, rounded up to a power of 2, keyed by
+//    the exact bit pattern of the abscissa.  A lookup probes at most 8
+//    consecutive slots.  If they are all taken, the new value replaces the
+//    one in the first of them, so the memory stays bounded.
+//
+//    Repeated abscissas arise when the same interval is integrated again
+//    with a tighter tolerance or another rule, at the center X = 0 that
+//    every rule shares, and at the ends that neighbouring subintervals
+//    share in the Clenshaw-Curtis rules of KRONROD_QAWO and KRONROD_QAWS.
+//    Plain bisection with Gauss-Kronrod rules repeats no abscissa, and
+//    gains nothing.
+//
+//    Copies share the table and the counters, since the integrators take
+//    F by value.  The table is locked during lookups, but not while F is
+//    called, so it may be used with THREADS > 1 if F may.
+//
+//    FloatingPoint must be trivially copyable.  Values equal but not
+//    identical in their bits, such as -0 and +0, or long doubles with
+//    different padding, are kept apart, which costs a miss but is never
+//    wrong.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  static_assert ( std::is_trivially_copyable<FloatingPoint>::value,
+    "KRONROD_MEMO keys on the bits of the abscissa." );
+
+public:
+
+  explicit kronrod_memo ( Function f, int capacity = 4096 )
+    : s ( std::make_shared<state> ( f ) )
+  {
+    std::size_t size = 8;
+    while ( size < std::size_t ( capacity ) )
+    {
+      size = 2 * size;
+    }
+    s->table.resize ( size );
+    s->mask = size - 1;
+  }
+
+  FloatingPoint operator ( ) ( const FloatingPoint& x ) const
+  {
+    std::size_t home = std::size_t ( kronrod_memo_hash ( x ) ) & s->mask;
+    {
+      std::lock_guard<std::mutex> lock ( s->mtx );
+      for ( int k = 0; k < probes; k++ )
+      {
+        const slot& p = s->table[( home + k ) & s->mask];
+        if ( !p.used )
+        {
+          break;
+        }
+        if ( std::memcmp ( &p.x, &x, sizeof ( FloatingPoint ) ) == 0 )
+        {
+          s->hits = s->hits + 1;
+          return p.fx;
+        }
+      }
+      s->misses = s->misses + 1;
+    }
+
+    FloatingPoint fx = s->f ( x );
+
+    std::lock_guard<std::mutex> lock ( s->mtx );
+    slot* target = &s->table[home];
+    for ( int k = 0; k < probes; k++ )
+    {
+      slot& p = s->table[( home + k ) & s->mask];
+      if ( !p.used || std::memcmp ( &p.x, &x, sizeof ( FloatingPoint ) ) == 0 )
+      {
+        target = &p;
+        break;
+      }
+    }
+    target->used = true;
+    target->x = x;
+    target->fx = fx;
+
+    return fx;
+  }
+
+  long hits ( ) const
+  {
+    std::lock_guard<std::mutex> lock ( s->mtx );
+    return s->hits;
+  }
+
+  long misses ( ) const
+  {
+    std::lock_guard<std::mutex> lock ( s->mtx );
+    return s->misses;
+  }
+
+  void clear ( )
+  {
+    std::lock_guard<std::mutex> lock ( s->mtx );
+    for ( slot& p : s->table )
+    {
+      p.used = false;
+    }
+    s->hits = 0;
+    s->misses = 0;
+  }
+
+private:
+
+  static const int probes = 8;
+
+  struct slot
+  {
+    bool used = false;
+    FloatingPoint x;
+    FloatingPoint fx;
+  };
+
+  struct state
+  {
+    explicit state ( Function f ) : f ( f )
+    {
+    }
+
+    Function f;
+    std::vector<slot> table;
+    std::size_t mask = 0;
+    std::mutex mtx;
+    long hits = 0;
+    long misses = 0;
+  };
+
+  std::shared_ptr<state> s;
+};
+//****************************************************************************80
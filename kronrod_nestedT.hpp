@@ -0,0 +1,1469 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "kronrod_integrateT.hpp"
+
+template <typename FloatingPoint>
+int kronrod_fs ( int n, std::vector<FloatingPoint>& a, std::vector<FloatingPoint>& b )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_FS factors and solves a linear system.
+//
+//  Discussion:
+//
+//    This is Gaussian elimination with partial pivoting, as in R8MAT_FS.
+//    A is stored by rows, A[I*N+J], and is overwritten.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original C++ version by John Burkardt.
+//    This version by Okwuchukwu Nwobi.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the system.
+//
+//    Input/output, FloatingPoint A[N*N], the matrix.
+//
+//    Input/output, FloatingPoint B[N], the right hand side, and on output
+//    the solution.
+//
+//    Output, int KRONROD_FS, 0, or the index, from 1, of a zero pivot.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  for ( int j = 0; j < n; j++ )
+  {
+//
+//  Choose a pivot row.
+//
+    int ipiv = j;
+    for ( int i = j + 1; i < n; i++ )
+    {
+      if ( scalar::abs ( a[ipiv*n+j] ) < scalar::abs ( a[i*n+j] ) )
+      {
+        ipiv = i;
+      }
+    }
+
+    if ( a[ipiv*n+j] == FloatingPoint ( 0 ) )
+    {
+      return j + 1;
+    }
+
+    if ( ipiv != j )
+    {
+      for ( int k = 0; k < n; k++ )
+      {
+        std::swap ( a[j*n+k], a[ipiv*n+k] );
+      }
+      std::swap ( b[j], b[ipiv] );
+    }
+//
+//  Eliminate below the pivot.
+//
+    for ( int i = j + 1; i < n; i++ )
+    {
+      FloatingPoint t = a[i*n+j] / a[j*n+j];
+      for ( int k = j; k < n; k++ )
+      {
+        a[i*n+k] = a[i*n+k] - t * a[j*n+k];
+      }
+      b[i] = b[i] - t * b[j];
+    }
+  }
+//
+//  Back solve.
+//
+  for ( int j = n - 1; 0 <= j; j-- )
+  {
+    for ( int k = j + 1; k < n; k++ )
+    {
+      b[j] = b[j] - a[j*n+k] * b[k];
+    }
+    b[j] = b[j] / a[j*n+j];
+  }
+
+  return 0;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_legendre_quadrature ( int degree, std::vector<FloatingPoint>& xq,
+  std::vector<FloatingPoint>& wq )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_LEGENDRE_QUADRATURE returns a rule exact up to a given degree.
+//
+//  Discussion:
+//
+//    The Gauss-Kronrod rule of order Q is exact for polynomials of degree
+//    3*Q+1, so the smallest such Q is taken.  The abscissas are returned
+//    with both signs.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int DEGREE, the degree to integrate exactly.
+//
+//    Output, std::vector<FloatingPoint>& XQ, WQ, the abscissas and weights.
+//
+{
+  int q = std::max ( 1, ( degree + 1 ) / 3 );
+  auto [x, w1, w2] = kronrod<FloatingPoint> ( q );
+
+  xq.clear ( );
+  wq.clear ( );
+  for ( int i = 0; i < q; i++ )
+  {
+    xq.push_back ( x[i] );
+    wq.push_back ( w1[i] );
+    xq.push_back ( - x[i] );
+    wq.push_back ( w1[i] );
+  }
+  xq.push_back ( x[q] );
+  wq.push_back ( w1[q] );
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_extension ( const std::vector<FloatingPoint>& base, int m,
+  std::vector<FloatingPoint>& roots )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_EXTENSION adds M abscissas of highest degree to a set.
+//
+//  Discussion:
+//
+//    BASE is a set of abscissas in [-1,+1], with node polynomial Q.  The new
+//    abscissas are the zeros of the polynomial F of degree M for which Q*F
+//    is orthogonal to all polynomials of degree less than M.  The
+//    interpolatory rule on both sets together is then exact for degree
+//    NB+2*M-1, NB being the size of BASE.  With an empty BASE, F is the
+//    Legendre polynomial; with the Gauss abscissas, the Stieltjes
+//    polynomial of Kronrod's extension; with the Gauss-Kronrod abscissas,
+//    that of Patterson's; with {-1,+1}, the derivative of a Legendre
+//    polynomial, whose zeros are the interior abscissas of Gauss-Lobatto;
+//    and with {-1}, those of Gauss-Radau.
+//
+//    F is expanded in Legendre polynomials, F = P(M) + sum C(J) P(J),
+//    and the orthogonality conditions are solved for the C(J).  The
+//    integrals are done exactly by a Gauss-Kronrod rule.  If BASE is
+//    symmetric about 0, F is even or odd, as M, and the conditions are
+//    only nontrivial for half the degrees, so only half the C(J) are
+//    unknown.
+//
+//    The zeros are isolated on a grid of 16 points per expected zero,
+//    uniform in the angle ACOS(X), and refined by bisection.
+//
+//    The extension need not exist.  The function returns false if F does
+//    not have M simple zeros inside (-1,+1) and apart from BASE, which is
+//    the usual way that Kronrod and Patterson extensions fail.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Thomas Patterson,
+//    The Optimum Addition of Points to Quadrature Formulae,
+//    Mathematics of Computation,
+//    Volume 22, Number 104, October 1968, pages 847-856.
+//
+//  Parameters:
+//
+//    Input, std::vector<FloatingPoint> BASE, the abscissas, with both signs.
+//
+//    Input, int M, the number of abscissas to add.
+//
+//    Output, std::vector<FloatingPoint>& ROOTS, the new abscissas, in
+//    decreasing order.
+//
+//    Output, bool KRONROD_EXTENSION, true if the extension exists.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  int nb = int ( base.size ( ) );
+
+  roots.clear ( );
+  if ( m <= 0 )
+  {
+    return true;
+  }
+
+  std::vector<FloatingPoint> sorted = base;
+  std::sort ( sorted.begin ( ), sorted.end ( ) );
+  bool symmetric = true;
+  for ( int i = 0; i < nb; i++ )
+  {
+    if ( sorted[i] != - sorted[nb-1-i] )
+    {
+      symmetric = false;
+    }
+  }
+//
+//  A symmetric set with 0 in it cannot take an odd number of new
+//  symmetric abscissas.
+//
+  if ( symmetric && nb % 2 == 1 && m % 2 == 1 )
+  {
+    return false;
+  }
+//
+//  G = weight times Q at the abscissas of an exact rule, and
+//  P(K) the Legendre values there.
+//
+  std::vector<FloatingPoint> xq;
+  std::vector<FloatingPoint> wq;
+  kronrod_legendre_quadrature ( nb + 2 * m - 1, xq, wq );
+  int nq = int ( xq.size ( ) );
+
+  std::vector<FloatingPoint> g ( nq );
+  std::vector<FloatingPoint> p ( ( m + 1 ) * nq );
+  for ( int q = 0; q < nq; q++ )
+  {
+    g[q] = wq[q];
+    for ( int i = 0; i < nb; i++ )
+    {
+      g[q] = g[q] * ( xq[q] - base[i] );
+    }
+    p[q] = FloatingPoint ( 1 );
+    if ( 0 < m )
+    {
+      p[nq+q] = xq[q];
+    }
+    for ( int k = 1; k < m; k++ )
+    {
+      p[(k+1)*nq+q] = ( FloatingPoint ( 2 * k + 1 ) * xq[q] * p[k*nq+q]
+        - FloatingPoint ( k ) * p[(k-1)*nq+q] ) / FloatingPoint ( k + 1 );
+    }
+  }
+//
+//  If BASE is symmetric, the unknowns are the C(J) with J of the parity
+//  of M, and the conditions those on the P(K) with Q*F*P(K) even.
+//
+  std::vector<int> js;
+  std::vector<int> ks;
+  int step = symmetric ? 2 : 1;
+  for ( int j = symmetric ? m % 2 : 0; j < m; j = j + step )
+  {
+    js.push_back ( j );
+  }
+  for ( int k = symmetric ? ( nb + m ) % 2 : 0; k < m; k = k + step )
+  {
+    ks.push_back ( k );
+  }
+  int nc = int ( js.size ( ) );
+
+  std::vector<FloatingPoint> c ( m + 1, FloatingPoint ( 0 ) );
+  c[m] = FloatingPoint ( 1 );
+
+  if ( 0 < nc )
+  {
+    std::vector<FloatingPoint> a ( nc * nc, FloatingPoint ( 0 ) );
+    std::vector<FloatingPoint> rhs ( nc, FloatingPoint ( 0 ) );
+    for ( int r = 0; r < nc; r++ )
+    {
+      for ( int q = 0; q < nq; q++ )
+      {
+        FloatingPoint gp = g[q] * p[ks[r]*nq+q];
+        for ( int s = 0; s < nc; s++ )
+        {
+          a[r*nc+s] = a[r*nc+s] + gp * p[js[s]*nq+q];
+        }
+        rhs[r] = rhs[r] - gp * p[m*nq+q];
+      }
+    }
+    if ( kronrod_fs ( nc, a, rhs ) != 0 )
+    {
+      return false;
+    }
+    for ( int s = 0; s < nc; s++ )
+    {
+      c[js[s]] = rhs[s];
+    }
+  }
+
+  auto fval = [&c, m] ( const FloatingPoint& x )
+  {
+    FloatingPoint pm1 = FloatingPoint ( 1 );
+    FloatingPoint p0 = x;
+    FloatingPoint value = c[0] + c[1] * x;
+    for ( int k = 1; k < m; k++ )
+    {
+      FloatingPoint p1 = ( FloatingPoint ( 2 * k + 1 ) * x * p0
+        - FloatingPoint ( k ) * pm1 ) / FloatingPoint ( k + 1 );
+      value = value + c[k+1] * p1;
+      pm1 = p0;
+      p0 = p1;
+    }
+    return value;
+  };
+//
+//  Isolate the zeros, and refine them by bisection.
+//
+  int ngrid = 16 * ( nb + m + 1 );
+  int itmax = 4 * scalar::digits ( ) + 64;
+  FloatingPoint pi = scalar::pi ( );
+  FloatingPoint xlo = FloatingPoint ( 1 );
+  FloatingPoint flo = fval ( xlo );
+
+  for ( int k = 1; k <= ngrid; k++ )
+  {
+    FloatingPoint xhi = ( k == ngrid ) ? FloatingPoint ( -1 )
+      : scalar::cos ( pi * FloatingPoint ( k ) / FloatingPoint ( ngrid ) );
+    FloatingPoint fhi = fval ( xhi );
+
+    if ( fhi == FloatingPoint ( 0 ) && k < ngrid )
+    {
+      roots.push_back ( xhi );
+    }
+    else if ( ( flo < FloatingPoint ( 0 ) && FloatingPoint ( 0 ) < fhi )
+      || ( FloatingPoint ( 0 ) < flo && fhi < FloatingPoint ( 0 ) ) )
+    {
+      FloatingPoint lo = xlo;
+      FloatingPoint hi = xhi;
+      for ( int it = 0; it < itmax; it++ )
+      {
+        FloatingPoint mid = ( lo + hi ) / FloatingPoint ( 2 );
+        if ( mid == lo || mid == hi )
+        {
+          break;
+        }
+        FloatingPoint fm = fval ( mid );
+        if ( fm == FloatingPoint ( 0 ) )
+        {
+          lo = mid;
+          hi = mid;
+          break;
+        }
+        if ( ( fm < FloatingPoint ( 0 ) ) == ( flo < FloatingPoint ( 0 ) ) )
+        {
+          lo = mid;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      FloatingPoint r = ( lo + hi ) / FloatingPoint ( 2 );
+//
+//  An odd F vanishes at 0, which the grid only brackets.
+//
+      if ( symmetric && m % 2 == 1
+        && scalar::abs ( r ) <= FloatingPoint ( 16 ) * scalar::epsilon ( ) )
+      {
+        r = FloatingPoint ( 0 );
+      }
+      roots.push_back ( r );
+    }
+
+    xlo = xhi;
+    flo = fhi;
+  }
+
+  if ( int ( roots.size ( ) ) != m )
+  {
+    return false;
+  }
+
+  FloatingPoint tol = FloatingPoint ( 16 ) * scalar::epsilon ( );
+  for ( const FloatingPoint& r : roots )
+  {
+    if ( FloatingPoint ( 1 ) - tol <= scalar::abs ( r ) )
+    {
+      return false;
+    }
+    for ( int i = 0; i < nb; i++ )
+    {
+      if ( scalar::abs ( r - base[i] ) <= tol )
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+std::vector<FloatingPoint> kronrod_interpolatory ( const std::vector<FloatingPoint>& x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTERPOLATORY returns the weights of the interpolatory rule.
+//
+//  Discussion:
+//
+//    W[I] is the integral over [-1,+1] of the Lagrange polynomial of
+//    X[I], done exactly by a Gauss-Kronrod rule.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, std::vector<FloatingPoint> X, distinct abscissas in [-1,+1].
+//
+//    Output, std::vector<FloatingPoint> KRONROD_INTERPOLATORY, the weights.
+//
+{
+  int n = int ( x.size ( ) );
+  std::vector<FloatingPoint> xq;
+  std::vector<FloatingPoint> wq;
+  std::vector<FloatingPoint> w ( n, FloatingPoint ( 0 ) );
+
+  kronrod_legendre_quadrature ( n - 1, xq, wq );
+
+  for ( int i = 0; i < n; i++ )
+  {
+    for ( std::size_t q = 0; q < xq.size ( ); q++ )
+    {
+      FloatingPoint l = wq[q];
+      for ( int j = 0; j < n; j++ )
+      {
+        if ( j != i )
+        {
+          l = l * ( xq[q] - x[j] ) / ( x[i] - x[j] );
+        }
+      }
+      w[i] = w[i] + l;
+    }
+  }
+
+  return w;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_nested ( const std::vector<FloatingPoint>& base, int m,
+  kronrod_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_NESTED extends a symmetric rule and returns the nested pair.
+//
+//  Discussion:
+//
+//    BASE holds the nonnegative abscissas of the lower rule, in
+//    decreasing order, as in KRONROD.  The M abscissas of
+//    KRONROD_EXTENSION are added, and RULE gets the layout of KRONROD:
+//    the nonnegative abscissas of both in decreasing order, ending with
+//    0; W1, the weights of the extended rule; W2, those of the lower
+//    rule, 0 at the new abscissas.  RULE.N is the number of positive
+//    abscissas.
+//
+//    Both sets together must have an odd size, so that 0 is among them.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, std::vector<FloatingPoint> BASE, the nonnegative abscissas.
+//
+//    Input, int M, the number of abscissas to add.
+//
+//    Output, kronrod_rule<FloatingPoint>& RULE, the nested pair.
+//
+//    Output, bool KRONROD_NESTED, true if the extension exists.
+//
+{
+  auto expand = [] ( const std::vector<FloatingPoint>& half )
+  {
+    std::vector<FloatingPoint> full;
+    for ( const FloatingPoint& x : half )
+    {
+      if ( FloatingPoint ( 0 ) < x )
+      {
+        full.push_back ( x );
+      }
+    }
+    int npos = int ( full.size ( ) );
+    for ( int i = 0; i < npos; i++ )
+    {
+      full.push_back ( - full[i] );
+    }
+    if ( int ( half.size ( ) ) > npos )
+    {
+      full.push_back ( FloatingPoint ( 0 ) );
+    }
+    return full;
+  };
+
+  std::vector<FloatingPoint> full = expand ( base );
+  std::vector<FloatingPoint> roots;
+
+  if ( ( int ( full.size ( ) ) + m ) % 2 == 0 )
+  {
+    return false;
+  }
+  if ( !kronrod_extension ( full, m, roots ) )
+  {
+    return false;
+  }
+
+  std::vector<FloatingPoint> x = base;
+  for ( const FloatingPoint& r : roots )
+  {
+    if ( !( r < FloatingPoint ( 0 ) ) )
+    {
+      x.push_back ( r );
+    }
+  }
+  std::sort ( x.begin ( ), x.end ( ),
+    [] ( const FloatingPoint& p, const FloatingPoint& q ) { return q < p; } );
+
+  int n = int ( x.size ( ) ) - 1;
+  std::vector<FloatingPoint> w1 = kronrod_interpolatory ( expand ( x ) );
+  std::vector<FloatingPoint> w2 = kronrod_interpolatory ( full );
+//
+//  EXPAND lists the positive abscissas first, in order, and 0 last.
+//
+  rule.n = n;
+  rule.x = x;
+  rule.w1.assign ( n + 1, FloatingPoint ( 0 ) );
+  rule.w2.assign ( n + 1, FloatingPoint ( 0 ) );
+  for ( int i = 0; i < n; i++ )
+  {
+    rule.w1[i] = w1[i];
+  }
+  rule.w1[n] = w1.back ( );
+
+  int nbpos = int ( full.size ( ) ) / 2;
+  int k = 0;
+  for ( int i = 0; i <= n && k < nbpos; i++ )
+  {
+    if ( x[i] == full[k] )
+    {
+      rule.w2[i] = w2[k];
+      k = k + 1;
+    }
+  }
+  if ( full.size ( ) % 2 == 1 )
+  {
+    rule.w2[n] = w2.back ( );
+  }
+
+  return true;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_patterson ( const kronrod_rule<FloatingPoint>& base,
+  kronrod_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_PATTERSON extends a nested rule in the manner of Patterson.
+//
+//  Discussion:
+//
+//    The 2*N+1 abscissas of BASE get 2*N+2 more, and RULE pairs the
+//    extended rule, which is exact for polynomials of degree 6*N+4 on
+//    4*N+3 abscissas, with the higher rule of BASE.  Starting from
+//    KRONROD_RULE(10), the rules of 21, 43 and 87 abscissas of
+//    QUADPACK's QNG follow; from KRONROD_RULE(1), Patterson's sequence
+//    of 3, 7, 15, 31, ... abscissas.
+//
+//    The extended rule reuses the 2*N+1 values of BASE, so one can stop
+//    at BASE and go on only if its error estimate is too large.  As a
+//    rule in KRONROD_INTEGRATE, it gives the error of BASE for the
+//    result of the extended rule.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Thomas Patterson,
+//    The Optimum Addition of Points to Quadrature Formulae,
+//    Mathematics of Computation,
+//    Volume 22, Number 104, October 1968, pages 847-856.
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> BASE, the rule to extend.
+//
+//    Output, kronrod_rule<FloatingPoint>& RULE, the extended pair.
+//
+//    Output, bool KRONROD_PATTERSON, true if the extension exists.
+//
+{
+  return kronrod_nested ( base.x, 2 * base.n + 2, rule );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_patterson ( int n, kronrod_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_PATTERSON extends the Gauss-Kronrod rule of order N.
+//
+//  Discussion:
+//
+//    The rule is generated in KRONROD_GENERATION<FloatingPoint>::TYPE and
+//    rounded, as in KRONROD_RULE.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Output, kronrod_rule<FloatingPoint>& RULE, the pair of the
+//    Gauss-Kronrod-Patterson rule of 4*N+3 abscissas and the
+//    Gauss-Kronrod rule of 2*N+1.
+//
+//    Output, bool KRONROD_PATTERSON, true if the extension exists.
+//
+{
+  typedef typename kronrod_generation<FloatingPoint>::type work;
+
+  kronrod_rule<work> extended;
+  if ( !kronrod_patterson ( kronrod_rule<work> ( n ), extended ) )
+  {
+    return false;
+  }
+  if constexpr ( std::is_same<work, FloatingPoint>::value )
+  {
+    rule = extended;
+  }
+  else
+  {
+    rule = kronrod_rule<FloatingPoint> ( extended );
+  }
+  return true;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_lobatto ( int n, kronrod_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_LOBATTO returns a Gauss-Lobatto rule and its Kronrod extension.
+//
+//  Discussion:
+//
+//    The Gauss-Lobatto rule of N abscissas includes -1 and +1, and is
+//    exact for degree 2*N-3.  Its Kronrod extension adds N-1 abscissas,
+//    and is exact for degree 3*N-3 when N is even, 3*N-2 when N is odd.
+//    W1 holds the weights of the extension and W2 those of Gauss-Lobatto,
+//    and X[0] = 1.
+//
+//    N = 2 gives the trapezoidal rule inside Simpson's, and N = 4 the
+//    pair of 4 and 7 abscissas used by Gander and Gautschi.
+//
+//    Since X[0] = 1, neighbouring subintervals share the values at their
+//    common end, which KRONROD_INTEGRATE_SHARED takes advantage of.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Walter Gander, Walter Gautschi,
+//    Adaptive Quadrature - Revisited,
+//    BIT,
+//    Volume 40, Number 1, March 2000, pages 84-101.
+//
+//  Parameters:
+//
+//    Input, int N, the number of Gauss-Lobatto abscissas, at least 2.
+//
+//    Output, kronrod_rule<FloatingPoint>& RULE, the nested pair.
+//
+//    Output, bool KRONROD_LOBATTO, true if the extension exists.
+//
+{
+  typedef typename kronrod_generation<FloatingPoint>::type work;
+
+  if ( n < 2 )
+  {
+    return false;
+  }
+
+  std::vector<work> ends = { work ( 1 ), work ( -1 ) };
+  std::vector<work> interior;
+  if ( !kronrod_extension ( ends, n - 2, interior ) )
+  {
+    return false;
+  }
+
+  std::vector<work> base = { work ( 1 ) };
+  for ( const work& r : interior )
+  {
+    if ( !( r < work ( 0 ) ) )
+    {
+      base.push_back ( r );
+    }
+  }
+
+  kronrod_rule<work> extended;
+  if ( !kronrod_nested ( base, n - 1, extended ) )
+  {
+    return false;
+  }
+  if constexpr ( std::is_same<work, FloatingPoint>::value )
+  {
+    rule = extended;
+  }
+  else
+  {
+    rule = kronrod_rule<FloatingPoint> ( extended );
+  }
+  return true;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_radau_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_RADAU_RULE holds a Gauss-Radau rule and its Kronrod extension.
+//
+//  Discussion:
+//
+//    A Radau rule is not symmetric, so all 2*N abscissas are kept, in
+//    increasing order, with X[0] = -1.  W1 holds the weights of the
+//    extension, and W2 those of Gauss-Radau, 0 at the new abscissas.
+//    The rule with +1 instead of -1 is its reflection, X -> -X.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int n = 0;
+  std::vector<FloatingPoint> x;
+  std::vector<FloatingPoint> w1;
+  std::vector<FloatingPoint> w2;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_radau ( int n, kronrod_radau_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_RADAU returns a Gauss-Radau rule and its Kronrod extension.
+//
+//  Discussion:
+//
+//    The Gauss-Radau rule of N abscissas includes -1, and is exact for
+//    degree 2*N-2.  Its N-1 other abscissas are the zeros of the Jacobi
+//    polynomial P(N-1,(0,1)), found by KRONROD_EXTENSION from {-1}.  The
+//    Kronrod extension adds N abscissas, and is exact for degree 3*N-1.
+//
+//    The rule is generated in KRONROD_GENERATION<FloatingPoint>::TYPE and
+//    rounded, as in KRONROD_RULE.
+//
+//    The rule suits a subinterval with one end at which F cannot be
+//    evaluated, while the value at the other is shared with a neighbour,
+//    as in KRONROD_INTEGRATE_SHARED.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Robert Piessens, Maria Branders,
+//    A Note on the Optimal Addition of Abscissas to Quadrature Formulas
+//    of Gauss and Lobatto,
+//    Mathematics of Computation,
+//    Volume 28, Number 125, January 1974, pages 135-139.
+//
+//  Parameters:
+//
+//    Input, int N, the number of Gauss-Radau abscissas, at least 1.
+//
+//    Output, kronrod_radau_rule<FloatingPoint>& RULE, the nested pair.
+//
+//    Output, bool KRONROD_RADAU, true if the extension exists.
+//
+{
+  typedef typename kronrod_generation<FloatingPoint>::type work;
+
+  if ( n < 1 )
+  {
+    return false;
+  }
+
+  std::vector<work> base = { work ( -1 ) };
+  std::vector<work> interior;
+  if ( !kronrod_extension ( base, n - 1, interior ) )
+  {
+    return false;
+  }
+  base.insert ( base.end ( ), interior.begin ( ), interior.end ( ) );
+
+  std::vector<work> added;
+  if ( !kronrod_extension ( base, n, added ) )
+  {
+    return false;
+  }
+
+  std::vector<work> x = base;
+  x.insert ( x.end ( ), added.begin ( ), added.end ( ) );
+  std::sort ( x.begin ( ), x.end ( ) );
+  std::sort ( base.begin ( ), base.end ( ) );
+
+  std::vector<work> w1 = kronrod_interpolatory ( x );
+  std::vector<work> w2 = kronrod_interpolatory ( base );
+
+  rule.n = n;
+  rule.x.resize ( 2 * n );
+  rule.w1.resize ( 2 * n );
+  rule.w2.assign ( 2 * n, FloatingPoint ( 0 ) );
+  int k = 0;
+  for ( int i = 0; i < 2 * n; i++ )
+  {
+    rule.x[i] = static_cast<FloatingPoint> ( x[i] );
+    rule.w1[i] = static_cast<FloatingPoint> ( w1[i] );
+    if ( k < n && x[i] == base[k] )
+    {
+      rule.w2[i] = static_cast<FloatingPoint> ( w2[k] );
+      k = k + 1;
+    }
+  }
+
+  return true;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qk_radau ( const kronrod_radau_rule<FloatingPoint>& rule,
+  Function& f, const FloatingPoint& a, const FloatingPoint& b, bool left,
+  const FloatingPoint& fend )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_RADAU applies a Radau-Kronrod rule, given F at one end.
+//
+//  Discussion:
+//
+//    If LEFT, the rule includes A, where F is FEND, and F is not
+//    evaluated at B.  Otherwise the rule is reflected, includes B, and F
+//    is not evaluated at A.  The estimates are those of KRONROD_QK_SUMS.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_radau_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, Function& F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, bool LEFT, true if the rule includes A, false if B.
+//
+//    Input, FloatingPoint FEND, the value of F at the included end.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK_RADAU, the
+//    interval with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  int m = 2 * rule.n;
+  FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+  FloatingPoint dir = left ? half : - half;
+  std::vector<FloatingPoint> fv ( m );
+
+  fv[0] = fend;
+  for ( int i = 1; i < m; i++ )
+  {
+    fv[i] = f ( center + dir * rule.x[i] );
+  }
+
+  FloatingPoint i1 = FloatingPoint ( 0 );
+  FloatingPoint i2 = FloatingPoint ( 0 );
+  FloatingPoint resabs = FloatingPoint ( 0 );
+  for ( int i = 0; i < m; i++ )
+  {
+    i1 = i1 + rule.w1[i] * fv[i];
+    i2 = i2 + rule.w2[i] * fv[i];
+    resabs = resabs + rule.w1[i] * scalar::abs ( fv[i] );
+  }
+  FloatingPoint mean = i1 / FloatingPoint ( 2 );
+  FloatingPoint resasc = FloatingPoint ( 0 );
+  for ( int i = 0; i < m; i++ )
+  {
+    resasc = resasc + rule.w1[i] * scalar::abs ( fv[i] - mean );
+  }
+
+  return kronrod_qk_estimate ( a, b, i1, i2, resabs, resasc );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qk_shared ( const kronrod_rule<FloatingPoint>& rule,
+  Function& f, const FloatingPoint& a, const FloatingPoint& b,
+  const FloatingPoint& fa, const FloatingPoint& fb )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_SHARED applies a rule with X[0] = 1, given F at the ends.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule, with X[0] = 1.
+//
+//    Input, Function& F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint FA, FB, the values of F at A and B.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK_SHARED, the
+//    interval with its estimates.
+//
+{
+  int n = rule.n;
+  FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+  std::vector<FloatingPoint> fv ( 2 * n + 1 );
+
+  fv[0] = fa;
+  fv[1] = fb;
+  fv[2*n] = f ( center );
+  for ( int i = 1; i < n; i++ )
+  {
+    FloatingPoint dx = half * rule.x[i];
+    fv[2*i] = f ( center - dx );
+    fv[2*i+1] = f ( center + dx );
+  }
+
+  return kronrod_qk_sums ( rule, fv, a, b );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_shared_bisection ( Function& f,
+  FloatingPoint a, FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule,
+  const kronrod_radau_rule<FloatingPoint>* radau, int limit )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_SHARED_BISECTION does the work of KRONROD_INTEGRATE_SHARED.
+//
+//  Discussion:
+//
+//    If RADAU is null, F is evaluated at A and B.  Otherwise the
+//    subintervals that touch A or B are done by the Radau-Kronrod rule
+//    that leaves that end out, and [A,B] is bisected before anything
+//    else, so that no subinterval touches both.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function& F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule, with X[0] = 1.
+//
+//    Input, const kronrod_radau_rule<FloatingPoint>* RADAU, the rule for
+//    the ends, or null.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_SHARED_BISECTION, the
+//    integral and error estimates.
+//
+{
+  struct panel
+  {
+    kronrod_interval<FloatingPoint> p;
+    FloatingPoint fa;
+    FloatingPoint fb;
+    bool open_a;
+    bool open_b;
+  };
+
+  if ( rule.n < 1 || rule.x[0] != FloatingPoint ( 1 ) )
+  {
+    std::cout << "\n";
+    std::cout << "KRONROD_INTEGRATE_SHARED - Fatal error!\n";
+    std::cout << "  The rule does not include the ends of the interval.\n";
+    exit ( 1 );
+  }
+
+  int calls = 0;
+  auto g = [&f, &calls] ( const FloatingPoint& x )
+  {
+    calls = calls + 1;
+    return f ( x );
+  };
+//
+//  Apply the rule that fits the ends of Q, with the end values known.
+//
+  auto apply = [&] ( panel& q )
+  {
+    if ( q.open_a )
+    {
+      q.p = kronrod_qk_radau ( *radau, g, q.p.a, q.p.b, false, q.fb );
+    }
+    else if ( q.open_b )
+    {
+      q.p = kronrod_qk_radau ( *radau, g, q.p.a, q.p.b, true, q.fa );
+    }
+    else
+    {
+      q.p = kronrod_qk_shared ( rule, g, q.p.a, q.p.b, q.fa, q.fb );
+    }
+  };
+
+  kronrod_worse<FloatingPoint> worse;
+  auto panel_worse = [&worse] ( const panel& p, const panel& q )
+  {
+    return worse ( p.p, q.p );
+  };
+
+  std::vector<panel> heap;
+  kronrod_result<FloatingPoint> value;
+  kronrod_sum<FloatingPoint> total;
+
+  if ( radau == nullptr )
+  {
+    panel whole;
+    whole.p.a = a;
+    whole.p.b = b;
+    whole.fa = g ( a );
+    whole.fb = g ( b );
+    whole.open_a = false;
+    whole.open_b = false;
+    apply ( whole );
+    heap.push_back ( whole );
+    value.intervals = 1;
+  }
+  else
+  {
+    FloatingPoint mid = ( a + b ) / FloatingPoint ( 2 );
+    panel h1;
+    panel h2;
+    h1.p.a = a;
+    h1.p.b = mid;
+    h1.fa = FloatingPoint ( 0 );
+    h1.fb = g ( mid );
+    h1.open_a = true;
+    h1.open_b = false;
+    h2.p.a = mid;
+    h2.p.b = b;
+    h2.fa = h1.fb;
+    h2.fb = FloatingPoint ( 0 );
+    h2.open_a = false;
+    h2.open_b = true;
+    apply ( h1 );
+    apply ( h2 );
+    heap.push_back ( h1 );
+    heap.push_back ( h2 );
+    std::make_heap ( heap.begin ( ), heap.end ( ), panel_worse );
+    value.intervals = 2;
+  }
+
+  value.error = FloatingPoint ( 0 );
+  for ( const panel& q : heap )
+  {
+    total.add ( q.p.result );
+    value.error = value.error + q.p.error;
+  }
+  value.result = total.value ( );
+  value.ier = 0;
+
+  for ( ; ; )
+  {
+    FloatingPoint tol = std::max ( epsabs,
+      epsrel * kronrod_scalar<FloatingPoint>::abs ( value.result ) );
+
+    if ( value.error <= tol )
+    {
+      break;
+    }
+
+    if ( limit <= value.intervals )
+    {
+      value.ier = 1;
+      break;
+    }
+
+    std::pop_heap ( heap.begin ( ), heap.end ( ), panel_worse );
+    panel parent = heap.back ( );
+    heap.pop_back ( );
+
+    FloatingPoint mid = ( parent.p.a + parent.p.b ) / FloatingPoint ( 2 );
+    panel h1 = parent;
+    panel h2 = parent;
+    h1.p.b = mid;
+    h1.fb = g ( mid );
+    h1.open_b = false;
+    h2.p.a = mid;
+    h2.fa = h1.fb;
+    h2.open_a = false;
+    apply ( h1 );
+    apply ( h2 );
+
+    total.add ( h1.p.result );
+    total.add ( h2.p.result );
+    total.add ( - parent.p.result );
+    value.error = value.error + ( ( h1.p.error + h2.p.error ) - parent.p.error );
+
+    heap.push_back ( h1 );
+    std::push_heap ( heap.begin ( ), heap.end ( ), panel_worse );
+    heap.push_back ( h2 );
+    std::push_heap ( heap.begin ( ), heap.end ( ), panel_worse );
+
+    value.result = total.value ( );
+    value.intervals = value.intervals + 1;
+  }
+
+  std::sort ( heap.begin ( ), heap.end ( ),
+    [] ( const panel& p, const panel& q ) { return p.p.a < q.p.a; } );
+  kronrod_sum<FloatingPoint> sum;
+  value.error = FloatingPoint ( 0 );
+  for ( const panel& q : heap )
+  {
+    sum.add ( q.p.result );
+    value.error = value.error + q.p.error;
+  }
+  value.result = sum.value ( );
+  value.evaluations = calls;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate_shared ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_SHARED integrates F by bisection, sharing end values.
+//
+//  Discussion:
+//
+//    This is KRONROD_INTEGRATE with BATCH = 1, for a rule whose
+//    abscissas include the ends, such as those of KRONROD_LOBATTO.  Each
+//    subinterval keeps the values of F at its ends.  When it is bisected,
+//    the halves take them over and share the value at the midpoint, so a
+//    bisection costs 2*(2*N+1) - 3 values of F instead of 2*(2*N+1).
+//
+//    F must be finite at A and B.  If it is not, pass a Radau-Kronrod
+//    rule as well.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule, with X[0] = 1.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE_SHARED, the
+//    integral and error estimates.
+//
+{
+  return kronrod_shared_bisection ( f, a, b, epsabs, epsrel, rule,
+    static_cast<const kronrod_radau_rule<FloatingPoint>*> ( nullptr ), limit );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate_shared ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule,
+  const kronrod_radau_rule<FloatingPoint>& radau, int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_SHARED integrates F, which may be singular at the
+//    ends, by bisection, sharing the values at interior ends.
+//
+//  Discussion:
+//
+//    F is never evaluated at A or B.  The subintervals that touch them
+//    are done by RADAU, reflected so that it includes the other end, and
+//    the rest by RULE.  [A,B] starts out bisected.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule, with X[0] = 1.
+//
+//    Input, kronrod_radau_rule<FloatingPoint> RADAU, the rule for the
+//    subintervals at A and B.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE_SHARED, the
+//    integral and error estimates.
+//
+{
+  return kronrod_shared_bisection ( f, a, b, epsabs, epsrel, rule, &radau,
+    std::max ( limit, 2 ) );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate_nested ( Function f,
+  FloatingPoint a, FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const std::vector<kronrod_rule<FloatingPoint>>& rules )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_NESTED applies a sequence of nested rules until one
+//    is accurate enough.
+//
+//  Discussion:
+//
+//    Each rule of RULES must contain the abscissas of the one before, as
+//    KRONROD_RULE(10) and its KRONROD_PATTERSON extensions of 43 and 87
+//    abscissas do.  Only the new abscissas of each rule are evaluated,
+//    so a smooth integrand costs 21 values of F where the next rule
+//    would have cost 43.  This is QUADPACK's QNG with any sequence.
+//
+//    There is no subdivision.  IER is 1 if the last rule is not accurate
+//    enough, and the integrand should then go to KRONROD_INTEGRATE.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input, std::vector<kronrod_rule<FloatingPoint>> RULES, the sequence.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE_NESTED, the
+//    integral and error estimates.
+//
+{
+  std::vector<FloatingPoint> xold;
+  std::vector<FloatingPoint> fold;
+  std::vector<FloatingPoint> fv;
+  kronrod_result<FloatingPoint> value;
+  FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 1;
+  value.ier = 1;
+
+  for ( const kronrod_rule<FloatingPoint>& rule : rules )
+  {
+    int n = rule.n;
+    int nold = int ( xold.size ( ) ) - 1;
+    int k = 0;
+
+    fv.resize ( 2 * n + 1 );
+//
+//  Both lists of abscissas are decreasing, so the old ones are found by
+//  one merge.
+//
+    for ( int i = 0; i < n; i++ )
+    {
+      while ( k < nold && rule.x[i] < xold[k] )
+      {
+        k = k + 1;
+      }
+      if ( k < nold && xold[k] == rule.x[i] )
+      {
+        fv[2*i] = fold[2*k];
+        fv[2*i+1] = fold[2*k+1];
+      }
+      else
+      {
+        FloatingPoint dx = half * rule.x[i];
+        fv[2*i] = f ( center - dx );
+        fv[2*i+1] = f ( center + dx );
+        value.evaluations = value.evaluations + 2;
+      }
+    }
+    if ( 0 <= nold )
+    {
+      fv[2*n] = fold[2*nold];
+    }
+    else
+    {
+      fv[2*n] = f ( center );
+      value.evaluations = value.evaluations + 1;
+    }
+
+    kronrod_interval<FloatingPoint> p = kronrod_qk_sums ( rule, fv, a, b );
+    value.result = p.result;
+    value.error = p.error;
+    xold = rule.x;
+    fold = fv;
+
+    FloatingPoint tol = std::max ( epsabs,
+      epsrel * kronrod_scalar<FloatingPoint>::abs ( value.result ) );
+    if ( value.error <= tol )
+    {
+      value.ier = 0;
+      break;
+    }
+  }
+
+  return value;
+}
+//****************************************************************************80
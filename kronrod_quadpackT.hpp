@@ -0,0 +1,3726 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <algorithm>
+
+#include "kronrod_integrateT.hpp"
+
+//
+//  The routines in this file follow the FORTRAN77 QUADPACK routines of the
+//  same names.  Their arrays are indexed from 1, as in the original, so
+//  each one has an unused element 0.
+//
+
+template <typename FloatingPoint>
+void kronrod_qpsrt ( int limit, int last, int& maxerr, FloatingPoint& ermax,
+  const std::vector<FloatingPoint>& elist, std::vector<int>& iord, int& nrmax )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QPSRT maintains the descending ordering of error estimates.
+//
+//  Discussion:
+//
+//    IORD lists the subintervals by decreasing error estimate.  After the
+//    subinterval MAXERR has been bisected, with one half kept at MAXERR
+//    and the other added at LAST, both are moved to their places in IORD.
+//
+//    Once more than LIMIT/2+2 subintervals exist, only the first
+//    LIMIT+3-LAST entries are kept in order, since the others can no
+//    longer be bisected.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Input, int LAST, the number of subintervals.
+//
+//    Input/output, int &MAXERR, on output, the subinterval to bisect next,
+//    IORD[NRMAX].
+//
+//    Output, FloatingPoint &ERMAX, the error estimate of MAXERR.
+//
+//    Input, FloatingPoint ELIST[LAST], the error estimates.
+//
+//    Input/output, int IORD[LAST], the ordering.
+//
+//    Input/output, int &NRMAX, the position in IORD of MAXERR.
+//
+{
+  FloatingPoint errmax;
+  FloatingPoint errmin;
+  int i;
+  int ibeg;
+  int isucc;
+  int j;
+  int jbnd;
+  int jupbn;
+  int k;
+
+  if ( last <= 2 )
+  {
+    iord[1] = 1;
+    iord[2] = 2;
+  }
+  else
+  {
+//
+//  If the bisected interval is still larger than some of those ahead of
+//  it, which happens after the search for a large interval in QAGS,
+//  move it up.
+//
+    errmax = elist[maxerr];
+    while ( 1 < nrmax )
+    {
+      isucc = iord[nrmax-1];
+      if ( errmax <= elist[isucc] )
+      {
+        break;
+      }
+      iord[nrmax] = isucc;
+      nrmax = nrmax - 1;
+    }
+
+    jupbn = last;
+    if ( ( limit / 2 + 2 ) < last )
+    {
+      jupbn = limit + 3 - last;
+    }
+    errmin = elist[last];
+//
+//  Insert ERRMAX by traversing the list top-down.
+//
+    jbnd = jupbn - 1;
+    ibeg = nrmax + 1;
+
+    for ( i = ibeg; i <= jbnd; i++ )
+    {
+      isucc = iord[i];
+      if ( elist[isucc] <= errmax )
+      {
+        break;
+      }
+      iord[i-1] = isucc;
+    }
+
+    if ( jbnd < i )
+    {
+      iord[jbnd] = maxerr;
+      iord[jupbn] = last;
+    }
+    else
+    {
+//
+//  Insert ERRMIN by traversing the list bottom-up.
+//
+      iord[i-1] = maxerr;
+      k = jbnd;
+      for ( j = i; j <= jbnd; j++ )
+      {
+        isucc = iord[k];
+        if ( errmin < elist[isucc] )
+        {
+          break;
+        }
+        iord[k+1] = isucc;
+        k = k - 1;
+      }
+      iord[k+1] = last;
+    }
+  }
+
+  maxerr = iord[nrmax];
+  ermax = elist[maxerr];
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_qelg ( int& n, std::vector<FloatingPoint>& epstab,
+  FloatingPoint& result, FloatingPoint& abserr, FloatingPoint res3la[3],
+  int& nres )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QELG carries out Wynn's epsilon extrapolation algorithm.
+//
+//  Discussion:
+//
+//    EPSTAB holds the last diagonal of the epsilon table, with the newest
+//    partial sum in EPSTAB[N].  Each call adds one element to the table,
+//    and returns the best extrapolated value found along the new diagonal.
+//
+//    The error estimate compares the result with the previous three
+//    results, so it is only meaningful from the fourth call on.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Peter Wynn,
+//    On a device for computing the e_m(S_n) transformation,
+//    Mathematical Tables and Other Aids to Computation,
+//    Volume 10, 1956, pages 91-96.
+//
+//  Parameters:
+//
+//    Input/output, int &N, the number of elements in EPSTAB.
+//
+//    Input/output, FloatingPoint EPSTAB[52+1], the epsilon table.
+//
+//    Output, FloatingPoint &RESULT, the extrapolated value.
+//
+//    Output, FloatingPoint &ABSERR, an estimate of its error.
+//
+//    Input/output, FloatingPoint RES3LA[3], the last three results.
+//
+//    Input/output, int &NRES, the number of calls.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint delta1;
+  FloatingPoint delta2;
+  FloatingPoint delta3;
+  FloatingPoint e0;
+  FloatingPoint e1;
+  FloatingPoint e1abs;
+  FloatingPoint e2;
+  FloatingPoint e3;
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint epsinf;
+  FloatingPoint err1;
+  FloatingPoint err2;
+  FloatingPoint err3;
+  FloatingPoint error;
+  FloatingPoint oflow = scalar::max ( );
+  FloatingPoint res;
+  FloatingPoint ss;
+  FloatingPoint tol1;
+  FloatingPoint tol2;
+  FloatingPoint tol3;
+  int i;
+  int ib;
+  int ib2;
+  int ie;
+  int indx;
+  int k1;
+  int k2;
+  int k3;
+  int limexp = 50;
+  int newelm;
+  int num;
+  bool converged = false;
+
+  nres = nres + 1;
+  abserr = oflow;
+  result = epstab[n];
+
+  if ( n < 3 )
+  {
+    abserr = std::max ( abserr, FloatingPoint ( FloatingPoint ( 5 ) * epmach * scalar::abs ( result ) ) );
+    return;
+  }
+
+  epstab[n+2] = epstab[n];
+  newelm = ( n - 1 ) / 2;
+  epstab[n] = oflow;
+  num = n;
+  k1 = n;
+
+  for ( i = 1; i <= newelm; i++ )
+  {
+    k2 = k1 - 1;
+    k3 = k1 - 2;
+    res = epstab[k1+2];
+    e0 = epstab[k3];
+    e1 = epstab[k2];
+    e2 = res;
+    e1abs = scalar::abs ( e1 );
+    delta2 = e2 - e1;
+    err2 = scalar::abs ( delta2 );
+    tol2 = std::max ( scalar::abs ( e2 ), e1abs ) * epmach;
+    delta3 = e1 - e0;
+    err3 = scalar::abs ( delta3 );
+    tol3 = std::max ( e1abs, scalar::abs ( e0 ) ) * epmach;
+//
+//  If E0, E1 and E2 are equal to within machine accuracy, convergence
+//  is assumed.
+//
+    if ( err2 <= tol2 && err3 <= tol3 )
+    {
+      result = res;
+      abserr = err2 + err3;
+      converged = true;
+      break;
+    }
+
+    e3 = epstab[k1];
+    epstab[k1] = e1;
+    delta1 = e1 - e3;
+    err1 = scalar::abs ( delta1 );
+    tol1 = std::max ( e1abs, scalar::abs ( e3 ) ) * epmach;
+//
+//  If two elements are very close to each other, omit a part of the
+//  table by adjusting the value of N.
+//
+    if ( err1 <= tol1 || err2 <= tol2 || err3 <= tol3 )
+    {
+      n = i + i - 1;
+      break;
+    }
+
+    ss = FloatingPoint ( 1 ) / delta1 + FloatingPoint ( 1 ) / delta2
+      - FloatingPoint ( 1 ) / delta3;
+    epsinf = scalar::abs ( ss * e1 );
+//
+//  Test to detect irregular behaviour in the table, and eventually omit
+//  a part of the table adjusting the value of N.
+//
+    if ( epsinf <= FloatingPoint ( 1 ) / FloatingPoint ( 10000 ) )
+    {
+      n = i + i - 1;
+      break;
+    }
+//
+//  Compute a new element and eventually adjust the value of RESULT.
+//
+    res = e1 + FloatingPoint ( 1 ) / ss;
+    epstab[k1] = res;
+    k1 = k1 - 2;
+    error = err2 + scalar::abs ( res - e2 ) + err3;
+
+    if ( error <= abserr )
+    {
+      abserr = error;
+      result = res;
+    }
+  }
+
+  if ( !converged )
+  {
+//
+//  Shift the table.
+//
+    if ( n == limexp )
+    {
+      n = 2 * ( limexp / 2 ) - 1;
+    }
+
+    ib = 1;
+    if ( ( num / 2 ) * 2 == num )
+    {
+      ib = 2;
+    }
+    ie = newelm + 1;
+    for ( i = 1; i <= ie; i++ )
+    {
+      ib2 = ib + 2;
+      epstab[ib] = epstab[ib2];
+      ib = ib2;
+    }
+
+    if ( num != n )
+    {
+      indx = num - n + 1;
+      for ( i = 1; i <= n; i++ )
+      {
+        epstab[i] = epstab[indx];
+        indx = indx + 1;
+      }
+    }
+
+    if ( nres < 4 )
+    {
+      res3la[nres-1] = result;
+      abserr = oflow;
+    }
+    else
+    {
+      abserr = scalar::abs ( result - res3la[2] )
+        + scalar::abs ( result - res3la[1] )
+        + scalar::abs ( result - res3la[0] );
+      res3la[0] = res3la[1];
+      res3la[1] = res3la[2];
+      res3la[2] = result;
+    }
+  }
+
+  abserr = std::max ( abserr, FloatingPoint ( FloatingPoint ( 5 ) * epmach * scalar::abs ( result ) ) );
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function, typename FirstEstimate>
+kronrod_result<FloatingPoint> kronrod_qagse ( Function& f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit, FirstEstimate first_estimate )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAGSE integrates F over [A,B], accelerating the bisection with
+//    Wynn's epsilon algorithm.
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAGSE, with RULE in place of the 21 point
+//    Gauss-Kronrod rule.  It does the work of KRONROD_QAGS and
+//    KRONROD_QAGI.
+//
+//    FIRST_ESTIMATE() returns the estimates of RULE on the whole of [A,B].
+//    It is called once, after the input has been checked, so that
+//    KRONROD_QAGI can use its precomputed abscissas there.
+//
+//    The worst subinterval is bisected, as in
+//    KRONROD_INTEGRATE, but the sequence of integral estimates obtained
+//    each time the smallest subintervals have been bisected is
+//    extrapolated.  For integrands with endpoint singularities, such as
+//    log(x) or 1/sqrt(x), the sequence converges like a geometric series,
+//    and extrapolation removes most of the subdivisions that plain
+//    bisection needs.
+//
+//    Roundoff is detected as in QUADPACK, by counting bisections that do
+//    not change the integral estimate but do not reduce its error.
+//
+//    IER is that of QUADPACK:
+//    0, the requested accuracy was reached;
+//    1, the maximum number of subintervals was reached;
+//    2, roundoff error prevents the requested accuracy;
+//    3, the integrand behaves too badly at some points;
+//    4, the extrapolation table does not converge because of roundoff;
+//    5, the integral is probably divergent, or slowly convergent;
+//    6, the input is invalid.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Input, FirstEstimate FIRST_ESTIMATE, returns the estimates on [A,B].
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAGSE, the integral
+//    and error estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+  typedef kronrod_interval<FloatingPoint> interval;
+
+  FloatingPoint abseps;
+  FloatingPoint area;
+  FloatingPoint area1;
+  FloatingPoint area12;
+  FloatingPoint area2;
+  FloatingPoint correc = FloatingPoint ( 0 );
+  FloatingPoint defabs;
+  FloatingPoint dres;
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint erlarg = FloatingPoint ( 0 );
+  FloatingPoint erlast;
+  FloatingPoint errbnd;
+  FloatingPoint errmax;
+  FloatingPoint erro12;
+  FloatingPoint error1;
+  FloatingPoint error2;
+  FloatingPoint errsum;
+  FloatingPoint ertest = FloatingPoint ( 0 );
+  FloatingPoint oflow = scalar::max ( );
+  FloatingPoint res3la[3];
+  FloatingPoint resabs;
+  FloatingPoint reseps;
+  FloatingPoint small = FloatingPoint ( 0 );
+  FloatingPoint uflow = scalar::min ( );
+  FloatingPoint a1;
+  FloatingPoint a2;
+  FloatingPoint b1;
+  FloatingPoint b2;
+  bool extrap;
+  bool noext;
+  int id;
+  int ier;
+  int ierro;
+  int iroff1;
+  int iroff2;
+  int iroff3;
+  int jupbnd;
+  int k;
+  int ksgn;
+  int ktmin;
+  int last;
+  int maxerr;
+  int nres;
+  int nrmax;
+  int numrl2;
+  int per_rule = 2 * rule.n + 1;
+  bool final_sum = false;
+
+  kronrod_result<FloatingPoint> value;
+
+  limit = std::max ( limit, 1 );
+
+  std::vector<FloatingPoint> alist ( limit + 1 );
+  std::vector<FloatingPoint> blist ( limit + 1 );
+  std::vector<FloatingPoint> rlist ( limit + 1 );
+  std::vector<FloatingPoint> elist ( limit + 1 );
+  std::vector<int> iord ( limit + 1 );
+  std::vector<FloatingPoint> rlist2 ( 52 + 3 );
+
+  ier = 0;
+  alist[1] = a;
+  blist[1] = b;
+  rlist[1] = FloatingPoint ( 0 );
+  elist[1] = FloatingPoint ( 0 );
+  iord[1] = 0;
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 0;
+
+  if ( epsabs <= FloatingPoint ( 0 )
+    && epsrel < std::max ( FloatingPoint ( FloatingPoint ( 50 ) * epmach ),
+    FloatingPoint ( 5.0E-29 ) ) )
+  {
+    value.ier = 6;
+    return value;
+  }
+//
+//  First approximation to the integral.
+//
+  ierro = 0;
+  interval first = first_estimate ( );
+  value.result = first.result;
+  value.error = first.error;
+  defabs = first.resabs;
+  resabs = first.resasc;
+  dres = scalar::abs ( value.result );
+  errbnd = std::max ( epsabs, FloatingPoint ( epsrel * dres ) );
+  last = 1;
+  rlist[1] = value.result;
+  elist[1] = value.error;
+  iord[1] = 1;
+
+  if ( value.error <= FloatingPoint ( 100 ) * epmach * defabs && errbnd < value.error )
+  {
+    ier = 2;
+  }
+  if ( limit == 1 )
+  {
+    ier = 1;
+  }
+  if ( ier != 0 || ( value.error <= errbnd && value.error != resabs )
+    || value.error == FloatingPoint ( 0 ) )
+  {
+    value.ier = ier;
+    value.evaluations = per_rule;
+    value.intervals = 1;
+    return value;
+  }
+//
+//  Initialization.
+//
+  rlist2[1] = value.result;
+  errmax = value.error;
+  maxerr = 1;
+  area = value.result;
+  errsum = value.error;
+  value.error = oflow;
+  nrmax = 1;
+  nres = 0;
+  numrl2 = 2;
+  ktmin = 0;
+  extrap = false;
+  noext = false;
+  iroff1 = 0;
+  iroff2 = 0;
+  iroff3 = 0;
+  ksgn = -1;
+  if ( ( FloatingPoint ( 1 ) - FloatingPoint ( 50 ) * epmach ) * defabs <= dres )
+  {
+    ksgn = 1;
+  }
+//
+//  Main loop.
+//
+  for ( last = 2; last <= limit; last++ )
+  {
+//
+//  Bisect the subinterval with the NRMAX-th largest error estimate.
+//
+    a1 = alist[maxerr];
+    b1 = ( alist[maxerr] + blist[maxerr] ) / FloatingPoint ( 2 );
+    a2 = b1;
+    b2 = blist[maxerr];
+    erlast = errmax;
+
+    interval h1 = kronrod_qk ( rule, f, a1, b1 );
+    interval h2 = kronrod_qk ( rule, f, a2, b2 );
+    area1 = h1.result;
+    error1 = h1.error;
+    area2 = h2.result;
+    error2 = h2.error;
+//
+//  Improve previous approximations to integral and error and test for
+//  accuracy.
+//
+    area12 = area1 + area2;
+    erro12 = error1 + error2;
+    errsum = errsum + erro12 - errmax;
+    area = area + area12 - rlist[maxerr];
+
+    if ( h1.resasc != error1 && h2.resasc != error2 )
+    {
+      if ( scalar::abs ( rlist[maxerr] - area12 )
+        <= FloatingPoint ( 1.0E-05 ) * scalar::abs ( area12 )
+        && FloatingPoint ( 0.99 ) * errmax <= erro12 )
+      {
+        if ( extrap )
+        {
+          iroff2 = iroff2 + 1;
+        }
+        else
+        {
+          iroff1 = iroff1 + 1;
+        }
+      }
+      if ( 10 < last && errmax < erro12 )
+      {
+        iroff3 = iroff3 + 1;
+      }
+    }
+
+    rlist[maxerr] = area1;
+    rlist[last] = area2;
+    errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( area ) ) );
+//
+//  Test for roundoff error and eventually set error flag.
+//
+    if ( 10 <= iroff1 + iroff2 || 20 <= iroff3 )
+    {
+      ier = 2;
+    }
+    if ( 5 <= iroff2 )
+    {
+      ierro = 3;
+    }
+//
+//  Set error flag in the case that the number of subintervals equals
+//  LIMIT.
+//
+    if ( last == limit )
+    {
+      ier = 1;
+    }
+//
+//  Set error flag in the case of bad integrand behaviour at a point of
+//  the integration range.
+//
+    if ( std::max ( scalar::abs ( a1 ), scalar::abs ( b2 ) )
+      <= ( FloatingPoint ( 1 ) + FloatingPoint ( 100 ) * epmach )
+      * ( scalar::abs ( a2 ) + FloatingPoint ( 1000 ) * uflow ) )
+    {
+      ier = 4;
+    }
+//
+//  Append the newly created intervals to the list.
+//
+    if ( error2 <= error1 )
+    {
+      alist[last] = a2;
+      blist[maxerr] = b1;
+      blist[last] = b2;
+      elist[maxerr] = error1;
+      elist[last] = error2;
+    }
+    else
+    {
+      alist[maxerr] = a2;
+      alist[last] = a1;
+      blist[last] = b1;
+      rlist[maxerr] = area2;
+      rlist[last] = area1;
+      elist[maxerr] = error2;
+      elist[last] = error1;
+    }
+//
+//  Maintain the descending ordering of the list of error estimates and
+//  select the subinterval with NRMAX-th largest error estimate, to be
+//  bisected next.
+//
+    kronrod_qpsrt ( limit, last, maxerr, errmax, elist, iord, nrmax );
+
+    if ( errsum <= errbnd )
+    {
+      final_sum = true;
+      break;
+    }
+
+    if ( ier != 0 )
+    {
+      break;
+    }
+
+    if ( last == 2 )
+    {
+      small = scalar::abs ( b - a ) * FloatingPoint ( 0.375 );
+      erlarg = errsum;
+      ertest = errbnd;
+      rlist2[2] = area;
+      continue;
+    }
+
+    if ( noext )
+    {
+      continue;
+    }
+
+    erlarg = erlarg - erlast;
+
+    if ( small < scalar::abs ( b1 - a1 ) )
+    {
+      erlarg = erlarg + erro12;
+    }
+//
+//  Test whether the interval to be bisected next is the smallest
+//  interval.
+//
+    if ( !extrap )
+    {
+      if ( small < scalar::abs ( blist[maxerr] - alist[maxerr] ) )
+      {
+        continue;
+      }
+      extrap = true;
+      nrmax = 2;
+    }
+//
+//  The smallest interval has the largest error.  Before bisecting
+//  decrease the sum of the errors over the larger intervals (ERLARG)
+//  and perform extrapolation.
+//
+    bool large_found = false;
+
+    if ( ierro != 3 && ertest < erlarg )
+    {
+      id = nrmax;
+      jupbnd = last;
+      if ( 2 + limit / 2 < last )
+      {
+        jupbnd = limit + 3 - last;
+      }
+
+      for ( k = id; k <= jupbnd; k++ )
+      {
+        maxerr = iord[nrmax];
+        errmax = elist[maxerr];
+        if ( small < scalar::abs ( blist[maxerr] - alist[maxerr] ) )
+        {
+          large_found = true;
+          break;
+        }
+        nrmax = nrmax + 1;
+      }
+    }
+
+    if ( large_found )
+    {
+      continue;
+    }
+//
+//  Perform extrapolation.
+//
+    numrl2 = numrl2 + 1;
+    rlist2[numrl2] = area;
+    kronrod_qelg ( numrl2, rlist2, reseps, abseps, res3la, nres );
+    ktmin = ktmin + 1;
+
+    if ( 5 < ktmin && value.error < FloatingPoint ( 1.0E-03 ) * errsum )
+    {
+      ier = 5;
+    }
+
+    if ( abseps < value.error )
+    {
+      ktmin = 0;
+      value.error = abseps;
+      value.result = reseps;
+      correc = erlarg;
+      ertest = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( reseps ) ) );
+      if ( value.error <= ertest )
+      {
+        break;
+      }
+    }
+//
+//  Prepare bisection of the smallest interval.
+//
+    if ( numrl2 == 1 )
+    {
+      noext = true;
+    }
+
+    if ( ier == 5 )
+    {
+      break;
+    }
+
+    maxerr = iord[1];
+    errmax = elist[maxerr];
+    nrmax = 1;
+    extrap = false;
+    small = small / FloatingPoint ( 2 );
+    erlarg = errsum;
+  }
+
+  if ( last > limit )
+  {
+    last = limit;
+  }
+//
+//  Set the final result and error estimate.
+//
+  if ( !final_sum )
+  {
+    if ( value.error == oflow )
+    {
+      final_sum = true;
+    }
+    else if ( ier + ierro != 0 )
+    {
+      if ( ierro == 3 )
+      {
+        value.error = value.error + correc;
+      }
+      if ( ier == 0 )
+      {
+        ier = 3;
+      }
+      if ( value.result != FloatingPoint ( 0 ) && area != FloatingPoint ( 0 ) )
+      {
+        if ( errsum / scalar::abs ( area ) < value.error / scalar::abs ( value.result ) )
+        {
+          final_sum = true;
+        }
+      }
+      else if ( errsum < value.error )
+      {
+        final_sum = true;
+      }
+      else if ( area == FloatingPoint ( 0 ) )
+      {
+        if ( 2 < ier )
+        {
+          ier = ier - 1;
+        }
+        value.ier = ier;
+        value.evaluations = per_rule * ( 2 * last - 1 );
+        value.intervals = last;
+        return value;
+      }
+    }
+//
+//  Test on divergence.
+//
+    if ( !final_sum )
+    {
+      if ( !( ksgn == -1 && std::max ( scalar::abs ( value.result ),
+        scalar::abs ( area ) ) <= defabs * FloatingPoint ( 0.01 ) ) )
+      {
+        if ( value.result / area < FloatingPoint ( 0.01 )
+          || FloatingPoint ( 100 ) < value.result / area
+          || scalar::abs ( area ) < errsum )
+        {
+          ier = 6;
+        }
+      }
+    }
+  }
+//
+//  Compute the global integral sum.
+//
+  if ( final_sum )
+  {
+    value.result = FloatingPoint ( 0 );
+    for ( k = 1; k <= last; k++ )
+    {
+      value.result = value.result + rlist[k];
+    }
+    value.error = errsum;
+  }
+
+  if ( 2 < ier )
+  {
+    ier = ier - 1;
+  }
+
+  value.ier = ier;
+  value.evaluations = per_rule * ( 2 * last - 1 );
+  value.intervals = last;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qags ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAGS integrates F over [A,B] with extrapolation.
+//
+//  Discussion:
+//
+//    See KRONROD_QAGSE.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAGS, the integral
+//    and error estimates.
+//
+{
+  auto first_estimate = [&] ( ) { return kronrod_qk ( rule, f, a, b ); };
+
+  return kronrod_qagse ( f, a, b, epsabs, epsrel, rule, limit, first_estimate );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_infinite_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INFINITE_RULE holds a rule mapped to an infinite interval.
+//
+//  Discussion:
+//
+//    KRONROD_QAGI maps the infinite interval to (0,1] by X = (1-T)/T, so
+//    that the integral of F(X) becomes the integral of F((1-T)/T)/T^2.
+//    On the first pass, RULE is applied to the whole of (0,1], always at
+//    the same 2*N+1 values of T.  Their images S = (1-T)/T and Jacobians
+//    1/T^2 are tabulated here once per order.
+//
+//    For integrands that decay quickly, such as tail probabilities, the
+//    first pass is often the only one, and a call of KRONROD_QAGI then
+//    costs 2*N+1 function values and no divisions.  Construct the rule
+//    once and pass it to every call.
+//
+//    The entries are ordered as the function values of KRONROD_QK_SUMS:
+//    S[2*I] and S[2*I+1] correspond to T = (1-X[I])/2 and T = (1+X[I])/2,
+//    and S[2*N] to T = 1/2.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  kronrod_rule<FloatingPoint> rule;
+  std::vector<FloatingPoint> s;
+  std::vector<FloatingPoint> jacobian;
+
+  explicit kronrod_infinite_rule ( int n ) : rule ( n ), s ( 2 * n + 1 ),
+    jacobian ( 2 * n + 1 )
+  {
+    FloatingPoint half = FloatingPoint ( 1 ) / FloatingPoint ( 2 );
+
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint dx = half * rule.x[i];
+      set ( 2 * i, half - dx );
+      set ( 2 * i + 1, half + dx );
+    }
+    set ( 2 * n, half );
+  }
+
+private:
+
+  void set ( int k, const FloatingPoint& t )
+  {
+    s[k] = ( FloatingPoint ( 1 ) - t ) / t;
+    jacobian[k] = FloatingPoint ( 1 ) / ( t * t );
+  }
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qagi ( Function f, FloatingPoint bound,
+  int inf, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_infinite_rule<FloatingPoint>& rule, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAGI integrates F over an infinite or semi-infinite interval.
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAGI.  The interval is
+//    ( BOUND, +oo ) if INF = 1,
+//    ( -oo, BOUND ) if INF = -1,
+//    ( -oo, +oo ) if INF = 2, when BOUND is not used.
+//
+//    It is mapped to (0,1] by X = BOUND + INF * (1-T)/T, and the integral
+//    over (0,1] is computed by KRONROD_QAGSE.  For INF = 2, F(X) + F(-X)
+//    is integrated over ( 0, +oo ) instead.
+//
+//    The first pass uses the abscissas and Jacobians tabulated in RULE.
+//    Later passes map their abscissas with one division each; no
+//    transcendental function is evaluated apart from those in F.
+//
+//    EVALUATIONS counts the calls of F, two per abscissa when INF = 2.
+//    IER is that of KRONROD_QAGS, and is 6 if INF is not one of the above.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint BOUND, the finite end of the interval.
+//
+//    Input, int INF, the kind of interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_infinite_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAGI, the integral
+//    and error estimates.
+//
+{
+  kronrod_result<FloatingPoint> value;
+
+  if ( inf != 1 && inf != -1 && inf != 2 )
+  {
+    value.result = FloatingPoint ( 0 );
+    value.error = FloatingPoint ( 0 );
+    value.evaluations = 0;
+    value.intervals = 0;
+    value.ier = 6;
+    return value;
+  }
+
+  if ( inf == 2 )
+  {
+    bound = FloatingPoint ( 0 );
+  }
+  FloatingPoint dinf = FloatingPoint ( inf == -1 ? -1 : 1 );
+
+  auto g = [&] ( const FloatingPoint& t )
+  {
+    FloatingPoint s = ( FloatingPoint ( 1 ) - t ) / t;
+    FloatingPoint fval = f ( bound + dinf * s );
+    if ( inf == 2 )
+    {
+      fval = fval + f ( -s );
+    }
+    return fval / ( t * t );
+  };
+
+  auto first_estimate = [&] ( )
+  {
+    int m = 2 * rule.rule.n + 1;
+    std::vector<FloatingPoint> fv ( m );
+    for ( int k = 0; k < m; k++ )
+    {
+      FloatingPoint fval = f ( bound + dinf * rule.s[k] );
+      if ( inf == 2 )
+      {
+        fval = fval + f ( -rule.s[k] );
+      }
+      fv[k] = fval * rule.jacobian[k];
+    }
+    return kronrod_qk_sums ( rule.rule, fv, FloatingPoint ( 0 ), FloatingPoint ( 1 ) );
+  };
+
+  value = kronrod_qagse ( g, FloatingPoint ( 0 ), FloatingPoint ( 1 ), epsabs,
+    epsrel, rule.rule, limit, first_estimate );
+
+  if ( inf == 2 )
+  {
+    value.evaluations = 2 * value.evaluations;
+  }
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+int kronrod_gtsl ( int n, FloatingPoint c[], FloatingPoint d[], FloatingPoint e[],
+  FloatingPoint b[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_GTSL solves a tridiagonal linear system.
+//
+//  Discussion:
+//
+//    This is LINPACK's DGTSL, Gaussian elimination with partial pivoting.
+//    Row K of the system is C[K] X[K-1] + D[K] X[K] + E[K] X[K+1] = B[K],
+//    for K = 1, ..., N.  C, D and E are overwritten.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Jack Dongarra.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the system.
+//
+//    Input/output, FloatingPoint C[N+1], D[N+1], E[N+1], the sub, main
+//    and super diagonals.
+//
+//    Input/output, FloatingPoint B[N+1], the right hand side, and on
+//    output the solution.
+//
+//    Output, int KRONROD_GTSL, 0, or the index of a zero pivot.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  int k;
+  int nm1 = n - 1;
+  FloatingPoint t;
+
+  c[1] = d[1];
+
+  if ( 1 <= nm1 )
+  {
+    d[1] = e[1];
+    e[1] = FloatingPoint ( 0 );
+    e[n] = FloatingPoint ( 0 );
+
+    for ( k = 1; k <= nm1; k++ )
+    {
+//
+//  Find the larger of the two rows, and interchange if necessary.
+//
+      if ( scalar::abs ( c[k] ) <= scalar::abs ( c[k+1] ) )
+      {
+        std::swap ( c[k], c[k+1] );
+        std::swap ( d[k], d[k+1] );
+        std::swap ( e[k], e[k+1] );
+        std::swap ( b[k], b[k+1] );
+      }
+
+      if ( c[k] == FloatingPoint ( 0 ) )
+      {
+        return k;
+      }
+
+      t = - c[k+1] / c[k];
+      c[k+1] = d[k+1] + t * d[k];
+      d[k+1] = e[k+1] + t * e[k];
+      e[k+1] = FloatingPoint ( 0 );
+      b[k+1] = b[k+1] + t * b[k];
+    }
+  }
+
+  if ( c[n] == FloatingPoint ( 0 ) )
+  {
+    return n;
+  }
+//
+//  Back solve.
+//
+  b[n] = b[n] / c[n];
+
+  if ( 1 < n )
+  {
+    b[nm1] = ( b[nm1] - d[nm1] * b[n] ) / c[nm1];
+    for ( k = n - 2; 1 <= k; k-- )
+    {
+      b[k] = ( b[k] - d[k] * b[k+1] - e[k] * b[k+2] ) / c[k];
+    }
+  }
+
+  return 0;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_chebyshev_moments ( const FloatingPoint& parint,
+  std::array<FloatingPoint,25>& chebmo )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_CHEBYSHEV_MOMENTS computes the modified Chebyshev moments of
+//    the Fourier weights.
+//
+//  Discussion:
+//
+//    On output, for K = 0, ..., 12 and P = PARINT,
+//    CHEBMO[2*K] = integral ( -1 <= X <= 1 ) T(2*K)(X) cos(P*X) dX,
+//    and for K = 0, ..., 11,
+//    CHEBMO[2*K+1] = integral ( -1 <= X <= 1 ) T(2*K+1)(X) sin(P*X) dX.
+//
+//    The moments satisfy a five term recurrence.  For |P| > 24 it is
+//    used forwards.  Otherwise forward recursion is unstable, and the
+//    moments are the solution of a boundary value problem, with the end
+//    value from an asymptotic formula, as in QUADPACK's QC25F.
+//
+//    PARINT must be greater than 2 in magnitude.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Maria Branders,
+//    On the computation of Fourier transforms of singular functions,
+//    Journal of Computational and Applied Mathematics,
+//    Volume 17, 1987, pages 255-263.
+//
+//  Parameters:
+//
+//    Input, FloatingPoint PARINT, the frequency on [-1,+1].
+//
+//    Output, std::array<FloatingPoint,25> &CHEBMO, the moments.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  const int noequ = 25;
+  FloatingPoint ac;
+  FloatingPoint an;
+  FloatingPoint an2;
+  FloatingPoint as;
+  FloatingPoint asap;
+  FloatingPoint ass;
+  FloatingPoint d[noequ+1];
+  FloatingPoint d1[noequ+1];
+  FloatingPoint d2[noequ+1];
+  FloatingPoint v[noequ+4];
+  FloatingPoint par2 = parint * parint;
+  FloatingPoint par22 = par2 + FloatingPoint ( 2 );
+  FloatingPoint sinpar = scalar::sin ( parint );
+  FloatingPoint cospar = scalar::cos ( parint );
+  int i;
+  int j;
+  int k;
+//
+//  The moments with respect to the cosine.
+//
+  v[1] = FloatingPoint ( 2 ) * sinpar / parint;
+  v[2] = ( FloatingPoint ( 8 ) * cospar + ( par2 + par2 - FloatingPoint ( 8 ) )
+    * sinpar / parint ) / par2;
+  v[3] = ( FloatingPoint ( 32 ) * ( par2 - FloatingPoint ( 12 ) ) * cospar
+    + ( FloatingPoint ( 2 ) * ( ( par2 - FloatingPoint ( 80 ) ) * par2
+    + FloatingPoint ( 192 ) ) * sinpar ) / parint ) / ( par2 * par2 );
+  ac = FloatingPoint ( 8 ) * cospar;
+  as = FloatingPoint ( 24 ) * parint * sinpar;
+
+  if ( scalar::abs ( parint ) <= FloatingPoint ( 24 ) )
+  {
+    an = FloatingPoint ( 6 );
+    for ( k = 1; k <= noequ - 1; k++ )
+    {
+      an2 = an * an;
+      d[k] = FloatingPoint ( -2 ) * ( an2 - FloatingPoint ( 4 ) ) * ( par22 - an2 - an2 );
+      d2[k] = ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) ) * par2;
+      d1[k+1] = ( an + FloatingPoint ( 3 ) ) * ( an + FloatingPoint ( 4 ) ) * par2;
+      v[k+3] = as - ( an2 - FloatingPoint ( 4 ) ) * ac;
+      an = an + FloatingPoint ( 2 );
+    }
+    an2 = an * an;
+    d[noequ] = FloatingPoint ( -2 ) * ( an2 - FloatingPoint ( 4 ) ) * ( par22 - an2 - an2 );
+    v[noequ+3] = as - ( an2 - FloatingPoint ( 4 ) ) * ac;
+    v[4] = v[4] - FloatingPoint ( 56 ) * par2 * v[3];
+    ass = parint * sinpar;
+    asap = ( ( ( ( ( FloatingPoint ( 210 ) * par2 - FloatingPoint ( 1 ) ) * cospar
+      - ( FloatingPoint ( 105 ) * par2 - FloatingPoint ( 63 ) ) * ass ) / an2
+      - ( FloatingPoint ( 1 ) - FloatingPoint ( 15 ) * par2 ) * cospar
+      + FloatingPoint ( 15 ) * ass ) / an2 - cospar + FloatingPoint ( 3 ) * ass ) / an2
+      - cospar ) / an2;
+    v[noequ+3] = v[noequ+3] - FloatingPoint ( 2 ) * asap * par2
+      * ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) );
+    kronrod_gtsl ( noequ, d1, d, d2, v + 3 );
+  }
+  else
+  {
+    an = FloatingPoint ( 4 );
+    for ( i = 4; i <= 13; i++ )
+    {
+      an2 = an * an;
+      v[i] = ( ( an2 - FloatingPoint ( 4 ) ) * ( FloatingPoint ( 2 ) * ( par22 - an2 - an2 )
+        * v[i-1] - ac ) + as - par2 * ( an + FloatingPoint ( 1 ) )
+        * ( an + FloatingPoint ( 2 ) ) * v[i-2] )
+        / ( par2 * ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) ) );
+      an = an + FloatingPoint ( 2 );
+    }
+  }
+
+  for ( j = 1; j <= 13; j++ )
+  {
+    chebmo[2*j-2] = v[j];
+  }
+//
+//  The moments with respect to the sine.
+//
+  v[1] = FloatingPoint ( 2 ) * ( sinpar - parint * cospar ) / par2;
+  v[2] = ( FloatingPoint ( 18 ) - FloatingPoint ( 48 ) / par2 ) * sinpar / par2
+    + ( FloatingPoint ( -2 ) + FloatingPoint ( 48 ) / par2 ) * cospar / parint;
+  ac = FloatingPoint ( -24 ) * parint * cospar;
+  as = FloatingPoint ( -8 ) * sinpar;
+
+  if ( scalar::abs ( parint ) <= FloatingPoint ( 24 ) )
+  {
+    an = FloatingPoint ( 5 );
+    for ( k = 1; k <= noequ - 1; k++ )
+    {
+      an2 = an * an;
+      d[k] = FloatingPoint ( -2 ) * ( an2 - FloatingPoint ( 4 ) ) * ( par22 - an2 - an2 );
+      d2[k] = ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) ) * par2;
+      d1[k+1] = ( an + FloatingPoint ( 3 ) ) * ( an + FloatingPoint ( 4 ) ) * par2;
+      v[k+2] = ac + ( an2 - FloatingPoint ( 4 ) ) * as;
+      an = an + FloatingPoint ( 2 );
+    }
+    an2 = an * an;
+    d[noequ] = FloatingPoint ( -2 ) * ( an2 - FloatingPoint ( 4 ) ) * ( par22 - an2 - an2 );
+    v[noequ+2] = ac + ( an2 - FloatingPoint ( 4 ) ) * as;
+    v[3] = v[3] - FloatingPoint ( 42 ) * par2 * v[2];
+    ass = parint * cospar;
+    asap = ( ( ( ( ( FloatingPoint ( 105 ) * par2 - FloatingPoint ( 63 ) ) * ass
+      + ( FloatingPoint ( 210 ) * par2 - FloatingPoint ( 1 ) ) * sinpar ) / an2
+      + ( FloatingPoint ( 15 ) * par2 - FloatingPoint ( 1 ) ) * sinpar
+      - FloatingPoint ( 15 ) * ass ) / an2 - FloatingPoint ( 3 ) * ass - sinpar ) / an2
+      - sinpar ) / an2;
+    v[noequ+2] = v[noequ+2] - FloatingPoint ( 2 ) * asap * par2
+      * ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) );
+    kronrod_gtsl ( noequ, d1, d, d2, v + 2 );
+  }
+  else
+  {
+    an = FloatingPoint ( 3 );
+    for ( i = 3; i <= 12; i++ )
+    {
+      an2 = an * an;
+      v[i] = ( ( an2 - FloatingPoint ( 4 ) ) * ( FloatingPoint ( 2 ) * ( par22 - an2 - an2 )
+        * v[i-1] + as ) + ac - par2 * ( an + FloatingPoint ( 1 ) )
+        * ( an + FloatingPoint ( 2 ) ) * v[i-2] )
+        / ( par2 * ( an - FloatingPoint ( 1 ) ) * ( an - FloatingPoint ( 2 ) ) );
+      an = an + FloatingPoint ( 2 );
+    }
+  }
+
+  for ( j = 1; j <= 12; j++ )
+  {
+    chebmo[2*j-1] = v[j];
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+const std::array<FloatingPoint,25>& kronrod_qcheb_nodes ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QCHEB_NODES returns the abscissas of the 25 point
+//    Clenshaw-Curtis rule.
+//
+//  Discussion:
+//
+//    Entry J is cos(J*PI/24).  The table is computed once.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  static const std::array<FloatingPoint,25> x = [] ( )
+  {
+    std::array<FloatingPoint,25> value;
+    FloatingPoint pi = scalar::pi ( );
+    for ( int j = 0; j <= 24; j++ )
+    {
+      value[j] = scalar::cos ( FloatingPoint ( j ) * pi / FloatingPoint ( 24 ) );
+    }
+    return value;
+  } ( );
+
+  return x;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_qcheb ( const std::array<FloatingPoint,25>& x,
+  const FloatingPoint fval[], FloatingPoint cheb12[], FloatingPoint cheb24[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QCHEB computes Chebyshev series expansions of degrees 12 and 24.
+//
+//  Discussion:
+//
+//    FVAL[J] is the function at X[J] = cos(J*PI/24), with FVAL[0] and
+//    FVAL[24] halved.  The coefficients of the interpolants of degrees
+//    12 and 24 are computed by the discrete cosine transform, the one of
+//    degree 12 using the even J only.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Parameters:
+//
+//    Input, std::array<FloatingPoint,25> X, the abscissas.
+//
+//    Input, FloatingPoint FVAL[25], the function values.
+//
+//    Output, FloatingPoint CHEB12[13], CHEB24[25], the coefficients.
+//
+{
+  for ( int k = 0; k <= 24; k++ )
+  {
+    FloatingPoint s24 = FloatingPoint ( 0 );
+    FloatingPoint s12 = FloatingPoint ( 0 );
+    for ( int j = 0; j <= 24; j++ )
+    {
+      int m = ( k * j ) % 48;
+      FloatingPoint c = ( m <= 24 ) ? x[m] : x[48-m];
+      s24 = s24 + c * fval[j];
+      if ( j % 2 == 0 )
+      {
+        s12 = s12 + c * fval[j];
+      }
+    }
+    cheb24[k] = s24 / FloatingPoint ( 12 );
+    if ( k <= 12 )
+    {
+      cheb12[k] = s12 / FloatingPoint ( 6 );
+    }
+  }
+  cheb24[0] = cheb24[0] / FloatingPoint ( 2 );
+  cheb24[24] = cheb24[24] / FloatingPoint ( 2 );
+  cheb12[0] = cheb12[0] / FloatingPoint ( 2 );
+  cheb12[12] = cheb12[12] / FloatingPoint ( 2 );
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+class kronrod_moment_cache
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_MOMENT_CACHE keeps the Chebyshev moments of KRONROD_QAWO.
+//
+//  Discussion:
+//
+//    The moments of a subinterval depend only on the frequency OMEGA and
+//    the LENGTH of the subinterval.  KRONROD_QAWO bisects, so the lengths
+//    are those of the whole interval divided by powers of 2, and the same
+//    few sets of moments are needed over and over, within a call and by
+//    every call with the same OMEGA and interval length.  Passing one
+//    cache to all these calls computes each set once.
+//
+//    The cache also holds the 25 abscissas cos(J*PI/24) of the
+//    Clenshaw-Curtis rule.
+//
+//    GET may be called from several threads.  Entries are never removed,
+//    so the references it returns stay valid for the life of the cache.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  kronrod_moment_cache ( )
+    : x ( kronrod_qcheb_nodes<FloatingPoint> ( ) )
+  {
+  }
+
+  const std::array<FloatingPoint,25>& get ( const FloatingPoint& omega,
+    const FloatingPoint& length )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+
+    std::pair<FloatingPoint,FloatingPoint> key ( omega, length );
+    auto it = moments.find ( key );
+    if ( it == moments.end ( ) )
+    {
+      it = moments.emplace ( key, std::array<FloatingPoint,25> ( ) ).first;
+      kronrod_chebyshev_moments ( FloatingPoint ( omega * length / FloatingPoint ( 2 ) ),
+        it->second );
+    }
+    return it->second;
+  }
+
+  std::size_t size ( )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+
+    return moments.size ( );
+  }
+
+  std::array<FloatingPoint,25> x;
+
+private:
+
+  std::mutex mtx;
+  std::map<std::pair<FloatingPoint,FloatingPoint>, std::array<FloatingPoint,25>> moments;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qc25f ( Function& f, const FloatingPoint& a,
+  const FloatingPoint& b, const FloatingPoint& omega, int integr,
+  const kronrod_rule<FloatingPoint>& rule, kronrod_moment_cache<FloatingPoint>& cache,
+  const FloatingPoint& length, int& neval )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QC25F integrates F(X)*cos(OMEGA*X) or F(X)*sin(OMEGA*X) on
+//    [A,B].
+//
+//  Discussion:
+//
+//    If OMEGA*(B-A)/2 is at most 2 in magnitude, RULE is applied to the
+//    product.  Otherwise F is interpolated by Chebyshev polynomials of
+//    degrees 12 and 24 at the points of the 25 point Clenshaw-Curtis
+//    rule, and the products with the weight are integrated exactly with
+//    the moments.  The error is estimated from the difference of the two.
+//
+//    The moments are those of a subinterval of length LENGTH, which
+//    should be B-A up to rounding.
+//
+//    For the Clenshaw-Curtis rule, RESASC is set to the overflow level,
+//    as in QUADPACK.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function &F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint OMEGA, the frequency.
+//
+//    Input, int INTEGR, 1 for the cosine, 2 for the sine.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule for low frequencies.
+//
+//    Input, kronrod_moment_cache<FloatingPoint> &CACHE, the moments.
+//
+//    Input, FloatingPoint LENGTH, the length of the interval.
+//
+//    Output, int &NEVAL, the number of function values.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QC25F, the interval
+//    with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint centr = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint hlgth = ( b - a ) / FloatingPoint ( 2 );
+  FloatingPoint parint = omega * hlgth;
+  FloatingPoint fval[25];
+  FloatingPoint cheb12[13];
+  FloatingPoint cheb24[25];
+  kronrod_interval<FloatingPoint> value;
+
+  if ( scalar::abs ( parint ) <= FloatingPoint ( 2 ) )
+  {
+    auto g = [&] ( const FloatingPoint& x )
+    {
+      FloatingPoint wx = ( integr == 1 ) ? scalar::cos ( omega * x ) : scalar::sin ( omega * x );
+      return f ( x ) * wx;
+    };
+    neval = 2 * rule.n + 1;
+    return kronrod_qk ( rule, g, a, b );
+  }
+
+  const std::array<FloatingPoint,25>& chebmo = cache.get ( omega, length );
+  const std::array<FloatingPoint,25>& x = cache.x;
+
+  FloatingPoint conc = hlgth * scalar::cos ( centr * omega );
+  FloatingPoint cons = hlgth * scalar::sin ( centr * omega );
+  neval = 25;
+//
+//  The coefficients of the Chebyshev interpolants of degrees 12 and 24.
+//
+  fval[0] = f ( centr + hlgth ) / FloatingPoint ( 2 );
+  fval[12] = f ( centr );
+  fval[24] = f ( centr - hlgth ) / FloatingPoint ( 2 );
+  for ( int j = 1; j < 12; j++ )
+  {
+    fval[j] = f ( centr + hlgth * x[j] );
+    fval[24-j] = f ( centr - hlgth * x[j] );
+  }
+
+  kronrod_qcheb ( x, fval, cheb12, cheb24 );
+//
+//  The integral and error estimates.
+//
+  FloatingPoint resc12 = FloatingPoint ( 0 );
+  FloatingPoint ress12 = FloatingPoint ( 0 );
+  FloatingPoint resc24 = FloatingPoint ( 0 );
+  FloatingPoint ress24 = FloatingPoint ( 0 );
+  FloatingPoint resabs = FloatingPoint ( 0 );
+
+  for ( int k = 0; k <= 24; k++ )
+  {
+    if ( k % 2 == 0 )
+    {
+      resc24 = resc24 + cheb24[k] * chebmo[k];
+    }
+    else
+    {
+      ress24 = ress24 + cheb24[k] * chebmo[k];
+    }
+    resabs = resabs + scalar::abs ( cheb24[k] );
+  }
+  for ( int k = 0; k <= 12; k++ )
+  {
+    if ( k % 2 == 0 )
+    {
+      resc12 = resc12 + cheb12[k] * chebmo[k];
+    }
+    else
+    {
+      ress12 = ress12 + cheb12[k] * chebmo[k];
+    }
+  }
+
+  FloatingPoint estc = scalar::abs ( resc24 - resc12 );
+  FloatingPoint ests = scalar::abs ( ress24 - ress12 );
+
+  value.a = a;
+  value.b = b;
+  value.resabs = resabs * scalar::abs ( hlgth );
+  value.resasc = scalar::max ( );
+
+  if ( integr == 1 )
+  {
+    value.result = conc * resc24 - cons * ress24;
+    value.error = scalar::abs ( conc * estc ) + scalar::abs ( cons * ests );
+  }
+  else
+  {
+    value.result = conc * ress24 + cons * resc24;
+    value.error = scalar::abs ( conc * ests ) + scalar::abs ( cons * estc );
+  }
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qawo ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint omega, int integr, FloatingPoint epsabs,
+  FloatingPoint epsrel, const kronrod_rule<FloatingPoint>& rule,
+  kronrod_moment_cache<FloatingPoint>& cache, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAWO integrates F(X)*cos(OMEGA*X) or F(X)*sin(OMEGA*X) over
+//    [A,B].
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAWO.  Subintervals are integrated by
+//    KRONROD_QC25F, with RULE where OMEGA times the half length is at most
+//    2, and with Clenshaw-Curtis and Chebyshev moments otherwise.  The
+//    bisection and extrapolation are those of KRONROD_QAGS, except that
+//    extrapolation only starts once the smallest subintervals are
+//    integrated with RULE.
+//
+//    The moments of each subinterval length are taken from CACHE.  Calls
+//    with the same OMEGA and the same length B-A reuse them.
+//
+//    IER is that of KRONROD_QAGS, and is 6 if INTEGR is not 1 or 2.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint OMEGA, the frequency.
+//
+//    Input, int INTEGR, 1 for the cosine, 2 for the sine.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule for low frequencies.
+//
+//    Input/output, kronrod_moment_cache<FloatingPoint> &CACHE, the moments.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAWO, the integral
+//    and error estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+  typedef kronrod_interval<FloatingPoint> interval;
+
+  FloatingPoint abseps;
+  FloatingPoint area;
+  FloatingPoint area1;
+  FloatingPoint area12;
+  FloatingPoint area2;
+  FloatingPoint correc = FloatingPoint ( 0 );
+  FloatingPoint defabs;
+  FloatingPoint domega = scalar::abs ( omega );
+  FloatingPoint dres;
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint erlarg = FloatingPoint ( 0 );
+  FloatingPoint erlast;
+  FloatingPoint errbnd;
+  FloatingPoint errmax;
+  FloatingPoint erro12;
+  FloatingPoint error1;
+  FloatingPoint error2;
+  FloatingPoint errsum;
+  FloatingPoint ertest = FloatingPoint ( 0 );
+  FloatingPoint oflow = scalar::max ( );
+  FloatingPoint res3la[3];
+  FloatingPoint reseps;
+  FloatingPoint small;
+  FloatingPoint uflow = scalar::min ( );
+  FloatingPoint width;
+  FloatingPoint a1;
+  FloatingPoint a2;
+  FloatingPoint b1;
+  FloatingPoint b2;
+  bool extall;
+  bool extrap;
+  bool noext;
+  int ier = 0;
+  int ierro;
+  int iroff1;
+  int iroff2;
+  int iroff3;
+  int jupbnd;
+  int k;
+  int ksgn;
+  int ktmin;
+  int last;
+  int maxerr;
+  int nev;
+  int nres;
+  int nrmax;
+  int nrmom;
+  int numrl2;
+  bool final_sum = false;
+
+  kronrod_result<FloatingPoint> value;
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 0;
+
+  if ( ( integr != 1 && integr != 2 ) || ( epsabs <= FloatingPoint ( 0 )
+    && epsrel < std::max ( FloatingPoint ( FloatingPoint ( 50 ) * epmach ),
+    FloatingPoint ( 5.0E-29 ) ) ) )
+  {
+    value.ier = 6;
+    return value;
+  }
+
+  limit = std::max ( limit, 1 );
+
+  std::vector<FloatingPoint> alist ( limit + 1 );
+  std::vector<FloatingPoint> blist ( limit + 1 );
+  std::vector<FloatingPoint> rlist ( limit + 1 );
+  std::vector<FloatingPoint> elist ( limit + 1 );
+  std::vector<int> iord ( limit + 1 );
+  std::vector<int> nnlog ( limit + 1 );
+  std::vector<FloatingPoint> rlist2 ( 52 + 3 );
+//
+//  LENGTHS[L] is the length of the subintervals of level L, those
+//  obtained by L bisections.
+//
+  std::vector<FloatingPoint> lengths ( 1, b - a );
+  auto length = [&] ( int level )
+  {
+    while ( int ( lengths.size ( ) ) <= level )
+    {
+      lengths.push_back ( lengths.back ( ) / FloatingPoint ( 2 ) );
+    }
+    return lengths[level];
+  };
+
+  alist[1] = a;
+  blist[1] = b;
+  nnlog[1] = 0;
+//
+//  First approximation to the integral.
+//
+  nrmom = 0;
+  interval first = kronrod_qc25f ( f, a, b, domega, integr, rule, cache, length ( 0 ), nev );
+  value.evaluations = nev;
+  value.result = first.result;
+  value.error = first.error;
+  defabs = first.resabs;
+  dres = scalar::abs ( value.result );
+  errbnd = std::max ( epsabs, FloatingPoint ( epsrel * dres ) );
+  last = 1;
+  rlist[1] = value.result;
+  elist[1] = value.error;
+  iord[1] = 1;
+
+  if ( value.error <= FloatingPoint ( 100 ) * epmach * defabs && errbnd < value.error )
+  {
+    ier = 2;
+  }
+  if ( limit == 1 )
+  {
+    ier = 1;
+  }
+  if ( ier != 0 || value.error <= errbnd )
+  {
+    if ( integr == 2 && omega < FloatingPoint ( 0 ) )
+    {
+      value.result = - value.result;
+    }
+    value.ier = ier;
+    value.intervals = 1;
+    return value;
+  }
+//
+//  Initializations.
+//
+  errmax = value.error;
+  maxerr = 1;
+  area = value.result;
+  errsum = value.error;
+  value.error = oflow;
+  nrmax = 1;
+  extrap = false;
+  noext = false;
+  ierro = 0;
+  iroff1 = 0;
+  iroff2 = 0;
+  iroff3 = 0;
+  ktmin = 0;
+  small = scalar::abs ( b - a ) * FloatingPoint ( 0.75 );
+  nres = 0;
+  numrl2 = 0;
+  extall = false;
+
+  if ( scalar::abs ( b - a ) * domega / FloatingPoint ( 2 ) <= FloatingPoint ( 2 ) )
+  {
+    numrl2 = 1;
+    extall = true;
+    rlist2[1] = value.result;
+  }
+  if ( scalar::abs ( b - a ) * domega / FloatingPoint ( 4 ) <= FloatingPoint ( 2 ) )
+  {
+    extall = true;
+  }
+
+  ksgn = -1;
+  if ( ( FloatingPoint ( 1 ) - FloatingPoint ( 50 ) * epmach ) * defabs <= dres )
+  {
+    ksgn = 1;
+  }
+//
+//  Main loop.
+//
+  for ( last = 2; last <= limit; last++ )
+  {
+//
+//  Bisect the subinterval with the NRMAX-th largest error estimate.
+//
+    nrmom = nnlog[maxerr] + 1;
+    a1 = alist[maxerr];
+    b1 = ( alist[maxerr] + blist[maxerr] ) / FloatingPoint ( 2 );
+    a2 = b1;
+    b2 = blist[maxerr];
+    erlast = errmax;
+
+    interval h1 = kronrod_qc25f ( f, a1, b1, domega, integr, rule, cache, length ( nrmom ), nev );
+    value.evaluations = value.evaluations + nev;
+    interval h2 = kronrod_qc25f ( f, a2, b2, domega, integr, rule, cache, length ( nrmom ), nev );
+    value.evaluations = value.evaluations + nev;
+    area1 = h1.result;
+    error1 = h1.error;
+    area2 = h2.result;
+    error2 = h2.error;
+//
+//  Improve previous approximations to integral and error and test for
+//  accuracy.
+//
+    area12 = area1 + area2;
+    erro12 = error1 + error2;
+    errsum = errsum + erro12 - errmax;
+    area = area + area12 - rlist[maxerr];
+
+    if ( h1.resasc != error1 && h2.resasc != error2 )
+    {
+      if ( scalar::abs ( rlist[maxerr] - area12 )
+        <= FloatingPoint ( 1.0E-05 ) * scalar::abs ( area12 )
+        && FloatingPoint ( 0.99 ) * errmax <= erro12 )
+      {
+        if ( extrap )
+        {
+          iroff2 = iroff2 + 1;
+        }
+        else
+        {
+          iroff1 = iroff1 + 1;
+        }
+      }
+      if ( 10 < last && errmax < erro12 )
+      {
+        iroff3 = iroff3 + 1;
+      }
+    }
+
+    rlist[maxerr] = area1;
+    rlist[last] = area2;
+    nnlog[maxerr] = nrmom;
+    nnlog[last] = nrmom;
+    errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( area ) ) );
+//
+//  Test for roundoff error and eventually set error flag.
+//
+    if ( 10 <= iroff1 + iroff2 || 20 <= iroff3 )
+    {
+      ier = 2;
+    }
+    if ( 5 <= iroff2 )
+    {
+      ierro = 3;
+    }
+//
+//  Set error flag in the case that the number of subintervals equals
+//  LIMIT.
+//
+    if ( last == limit )
+    {
+      ier = 1;
+    }
+//
+//  Set error flag in the case of bad integrand behaviour at a point of
+//  the integration range.
+//
+    if ( std::max ( scalar::abs ( a1 ), scalar::abs ( b2 ) )
+      <= ( FloatingPoint ( 1 ) + FloatingPoint ( 100 ) * epmach )
+      * ( scalar::abs ( a2 ) + FloatingPoint ( 1000 ) * uflow ) )
+    {
+      ier = 4;
+    }
+//
+//  Append the newly created intervals to the list.
+//
+    if ( error2 <= error1 )
+    {
+      alist[last] = a2;
+      blist[maxerr] = b1;
+      blist[last] = b2;
+      elist[maxerr] = error1;
+      elist[last] = error2;
+    }
+    else
+    {
+      alist[maxerr] = a2;
+      alist[last] = a1;
+      blist[last] = b1;
+      rlist[maxerr] = area2;
+      rlist[last] = area1;
+      elist[maxerr] = error2;
+      elist[last] = error1;
+    }
+//
+//  Maintain the descending ordering of the list of error estimates and
+//  select the subinterval with NRMAX-th largest error estimate, to be
+//  bisected next.
+//
+    kronrod_qpsrt ( limit, last, maxerr, errmax, elist, iord, nrmax );
+
+    if ( errsum <= errbnd )
+    {
+      final_sum = true;
+      break;
+    }
+
+    if ( ier != 0 )
+    {
+      break;
+    }
+
+    if ( last == 2 && extall )
+    {
+      small = small / FloatingPoint ( 2 );
+      numrl2 = numrl2 + 1;
+      rlist2[numrl2] = area;
+      ertest = errbnd;
+      erlarg = errsum;
+      continue;
+    }
+
+    if ( noext )
+    {
+      continue;
+    }
+
+    if ( extall )
+    {
+      erlarg = erlarg - erlast;
+      if ( small < scalar::abs ( b1 - a1 ) )
+      {
+        erlarg = erlarg + erro12;
+      }
+    }
+
+    if ( !extall || !extrap )
+    {
+//
+//  Test whether the interval to be bisected next is the smallest
+//  interval.
+//
+      width = scalar::abs ( blist[maxerr] - alist[maxerr] );
+      if ( small < width )
+      {
+        continue;
+      }
+      if ( !extall )
+      {
+//
+//  Test whether extrapolation can start, which it does once the
+//  smallest subintervals are integrated with RULE.
+//
+        small = small / FloatingPoint ( 2 );
+        if ( FloatingPoint ( 2 ) < width * domega / FloatingPoint ( 4 ) )
+        {
+          continue;
+        }
+        extall = true;
+        ertest = errbnd;
+        erlarg = errsum;
+        continue;
+      }
+      extrap = true;
+      nrmax = 2;
+    }
+
+    bool large_found = false;
+
+    if ( ierro != 3 && ertest < erlarg )
+    {
+//
+//  The smallest interval has the largest error.  Before bisecting
+//  decrease the sum of the errors over the larger intervals (ERLARG)
+//  and perform extrapolation.
+//
+      jupbnd = last;
+      if ( limit / 2 + 2 < last )
+      {
+        jupbnd = limit + 3 - last;
+      }
+      int id = nrmax;
+      for ( k = id; k <= jupbnd; k++ )
+      {
+        maxerr = iord[nrmax];
+        errmax = elist[maxerr];
+        if ( small < scalar::abs ( blist[maxerr] - alist[maxerr] ) )
+        {
+          large_found = true;
+          break;
+        }
+        nrmax = nrmax + 1;
+      }
+    }
+
+    if ( large_found )
+    {
+      continue;
+    }
+//
+//  Perform extrapolation.
+//
+    numrl2 = numrl2 + 1;
+    rlist2[numrl2] = area;
+
+    if ( 3 <= numrl2 )
+    {
+      kronrod_qelg ( numrl2, rlist2, reseps, abseps, res3la, nres );
+      ktmin = ktmin + 1;
+
+      if ( 5 < ktmin && value.error < FloatingPoint ( 1.0E-03 ) * errsum )
+      {
+        ier = 5;
+      }
+
+      if ( abseps < value.error )
+      {
+        ktmin = 0;
+        value.error = abseps;
+        value.result = reseps;
+        correc = erlarg;
+        ertest = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( reseps ) ) );
+        if ( value.error <= ertest )
+        {
+          break;
+        }
+      }
+//
+//  Prepare bisection of the smallest interval.
+//
+      if ( numrl2 == 1 )
+      {
+        noext = true;
+      }
+      if ( ier == 5 )
+      {
+        break;
+      }
+    }
+
+    maxerr = iord[1];
+    errmax = elist[maxerr];
+    nrmax = 1;
+    extrap = false;
+    small = small / FloatingPoint ( 2 );
+    erlarg = errsum;
+  }
+
+  if ( last > limit )
+  {
+    last = limit;
+  }
+//
+//  Set the final result.
+//
+  if ( !final_sum )
+  {
+    if ( value.error == oflow || nres == 0 )
+    {
+      final_sum = true;
+    }
+    else if ( ier + ierro != 0 )
+    {
+      if ( ierro == 3 )
+      {
+        value.error = value.error + correc;
+      }
+      if ( ier == 0 )
+      {
+        ier = 3;
+      }
+      if ( value.result != FloatingPoint ( 0 ) && area != FloatingPoint ( 0 ) )
+      {
+        if ( errsum / scalar::abs ( area ) < value.error / scalar::abs ( value.result ) )
+        {
+          final_sum = true;
+        }
+      }
+      else if ( errsum < value.error )
+      {
+        final_sum = true;
+      }
+      else if ( area == FloatingPoint ( 0 ) )
+      {
+        if ( 2 < ier )
+        {
+          ier = ier - 1;
+        }
+        if ( integr == 2 && omega < FloatingPoint ( 0 ) )
+        {
+          value.result = - value.result;
+        }
+        value.ier = ier;
+        value.intervals = last;
+        return value;
+      }
+    }
+//
+//  Test on divergence.
+//
+    if ( !final_sum )
+    {
+      if ( !( ksgn == -1 && std::max ( scalar::abs ( value.result ),
+        scalar::abs ( area ) ) <= defabs * FloatingPoint ( 0.01 ) ) )
+      {
+        if ( value.result / area < FloatingPoint ( 0.01 )
+          || FloatingPoint ( 100 ) < value.result / area
+          || scalar::abs ( area ) <= errsum )
+        {
+          ier = 6;
+        }
+      }
+    }
+  }
+//
+//  Compute the global integral sum.
+//
+  if ( final_sum )
+  {
+    value.result = FloatingPoint ( 0 );
+    for ( k = 1; k <= last; k++ )
+    {
+      value.result = value.result + rlist[k];
+    }
+    value.error = errsum;
+  }
+
+  if ( 2 < ier )
+  {
+    ier = ier - 1;
+  }
+
+  if ( integr == 2 && omega < FloatingPoint ( 0 ) )
+  {
+    value.result = - value.result;
+  }
+
+  value.ier = ier;
+  value.intervals = last;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qawf ( Function f, FloatingPoint a,
+  FloatingPoint omega, int integr, FloatingPoint epsabs,
+  const kronrod_rule<FloatingPoint>& rule,
+  kronrod_moment_cache<FloatingPoint>& cache, int limlst = 50, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAWF computes a Fourier integral over ( A, +oo ).
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAWF.  The integral of F(X)*cos(OMEGA*X) or
+//    F(X)*sin(OMEGA*X) is the sum of the integrals over the cycles
+//    [ A+(K-1)*C, A+K*C ], where C = (2*floor(|OMEGA|)+1)*PI/|OMEGA|.
+//    Each is computed by KRONROD_QAWO, with a decreasing share of EPSABS,
+//    and the series of partial sums is extrapolated by Wynn's epsilon
+//    algorithm.  The cycles all have the same length, so they share the
+//    moments in CACHE.
+//
+//    For OMEGA = 0, the cosine integral is computed by KRONROD_QAGI.
+//
+//    IER is
+//    0, the requested accuracy was reached;
+//    1, LIMLST cycles were integrated;
+//    4, the extrapolation of the partial sums does not converge;
+//    6, the input is invalid;
+//    7, KRONROD_QAWO failed on some cycles.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, the lower limit.
+//
+//    Input, FloatingPoint OMEGA, the frequency.
+//
+//    Input, int INTEGR, 1 for the cosine, 2 for the sine.
+//
+//    Input, FloatingPoint EPSABS, the absolute accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule for low frequencies.
+//
+//    Input/output, kronrod_moment_cache<FloatingPoint> &CACHE, the moments.
+//
+//    Input, int LIMLST, the maximum number of cycles, at least 3.
+//
+//    Input, int LIMIT, the maximum number of subintervals in a cycle.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAWF, the integral
+//    and error estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint abseps;
+  FloatingPoint c1;
+  FloatingPoint c2;
+  FloatingPoint correc = FloatingPoint ( 0 );
+  FloatingPoint cycle;
+  FloatingPoint drl = FloatingPoint ( 0 );
+  FloatingPoint ep;
+  FloatingPoint eps;
+  FloatingPoint epsa;
+  FloatingPoint errsum = FloatingPoint ( 0 );
+  FloatingPoint fact;
+  FloatingPoint p = FloatingPoint ( 0.9 );
+  FloatingPoint p1 = FloatingPoint ( 1 ) - p;
+  FloatingPoint res3la[3];
+  FloatingPoint reseps;
+  FloatingPoint uflow = scalar::min ( );
+  int ier = 0;
+  int ktmin = 0;
+  int ll = 0;
+  int lst;
+  int nres = 0;
+  int numrl2 = 0;
+  bool partial_sum = false;
+
+  kronrod_result<FloatingPoint> value;
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 0;
+
+  if ( ( integr != 1 && integr != 2 ) || epsabs <= FloatingPoint ( 0 ) || limlst < 3 )
+  {
+    value.ier = 6;
+    return value;
+  }
+
+  if ( omega == FloatingPoint ( 0 ) )
+  {
+    if ( integr == 1 )
+    {
+      kronrod_infinite_rule<FloatingPoint> irule ( rule.n );
+      value = kronrod_qagi ( f, a, 1, epsabs, FloatingPoint ( 0 ), irule, limit );
+    }
+    else
+    {
+      value.ier = 0;
+    }
+    return value;
+  }
+
+  std::vector<FloatingPoint> psum ( 52 + 3 );
+//
+//  Initializations.
+//
+  int l = int ( scalar::abs ( omega ) );
+  cycle = FloatingPoint ( 2 * l + 1 ) * scalar::pi ( ) / scalar::abs ( omega );
+  c1 = a;
+  c2 = cycle + a;
+  eps = epsabs;
+  if ( uflow / p1 < epsabs )
+  {
+    eps = epsabs * p1;
+  }
+  ep = eps;
+  fact = FloatingPoint ( 1 );
+//
+//  Main loop.
+//
+  for ( lst = 1; lst <= limlst; lst++ )
+  {
+//
+//  Integrate over the current cycle.
+//
+    epsa = eps * fact;
+    kronrod_result<FloatingPoint> r = kronrod_qawo ( f, c1, c2, omega, integr,
+      epsa, FloatingPoint ( 0 ), rule, cache, limit );
+    value.evaluations = value.evaluations + r.evaluations;
+    value.intervals = value.intervals + r.intervals;
+    fact = fact * p;
+    errsum = errsum + r.error;
+    drl = FloatingPoint ( 50 ) * scalar::abs ( r.result );
+//
+//  Test on accuracy with the partial sum.
+//
+    if ( errsum + drl <= epsabs && 6 <= lst )
+    {
+      partial_sum = true;
+    }
+    else
+    {
+      correc = std::max ( correc, r.error );
+      if ( r.ier != 0 )
+      {
+        eps = std::max ( ep, FloatingPoint ( correc * p1 ) );
+        ier = 7;
+      }
+      if ( ier == 7 && errsum + drl <= correc * FloatingPoint ( 10 ) && 5 < lst )
+      {
+        partial_sum = true;
+      }
+    }
+
+    numrl2 = numrl2 + 1;
+    if ( lst == 1 )
+    {
+      psum[1] = r.result;
+    }
+    else
+    {
+      psum[numrl2] = psum[ll] + r.result;
+    }
+
+    if ( partial_sum )
+    {
+      break;
+    }
+
+    if ( 2 < lst )
+    {
+//
+//  Test on the maximum number of cycles.
+//
+      if ( lst == limlst )
+      {
+        ier = 8;
+      }
+//
+//  Perform a new extrapolation.
+//
+      kronrod_qelg ( numrl2, psum, reseps, abseps, res3la, nres );
+//
+//  Test whether the extrapolated result is influenced by roundoff.
+//
+      ktmin = ktmin + 1;
+      if ( 15 <= ktmin && value.error <= FloatingPoint ( 1.0E-03 ) * ( errsum + drl ) )
+      {
+        ier = 9;
+      }
+      if ( abseps <= value.error || lst == 3 )
+      {
+        value.error = abseps;
+        value.result = reseps;
+        ktmin = 0;
+//
+//  If IER is not 0, check whether the partial sum or the extrapolated
+//  result is the better approximation.
+//
+        if ( value.error + FloatingPoint ( 10 ) * correc <= epsabs
+          || ( value.error <= epsabs && epsabs <= FloatingPoint ( 10 ) * correc ) )
+        {
+          break;
+        }
+      }
+      if ( ier != 0 && ier != 7 )
+      {
+        break;
+      }
+    }
+
+    ll = numrl2;
+    c1 = c2;
+    c2 = c2 + cycle;
+  }
+//
+//  Set the final result and error estimate.
+//
+  if ( !partial_sum )
+  {
+    value.error = value.error + FloatingPoint ( 10 ) * correc;
+    if ( ier != 0 )
+    {
+      if ( value.result != FloatingPoint ( 0 ) && psum[numrl2] != FloatingPoint ( 0 ) )
+      {
+        if ( ( errsum + drl ) / scalar::abs ( psum[numrl2] )
+          < value.error / scalar::abs ( value.result ) )
+        {
+          partial_sum = true;
+        }
+        else if ( 1 <= ier && ier != 7 )
+        {
+          value.error = value.error + drl;
+        }
+      }
+      else if ( errsum < value.error || psum[numrl2] != FloatingPoint ( 0 ) )
+      {
+        partial_sum = true;
+      }
+    }
+  }
+
+  if ( partial_sum )
+  {
+    value.result = psum[numrl2];
+    value.error = errsum + drl;
+  }
+//
+//  Map the codes of QAWFE to those of QAWF.
+//
+  if ( ier == 8 )
+  {
+    ier = 1;
+  }
+  else if ( ier == 9 )
+  {
+    ier = 4;
+  }
+  value.ier = ier;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qc25c ( Function& f, const FloatingPoint& a,
+  const FloatingPoint& b, const FloatingPoint& c,
+  const kronrod_rule<FloatingPoint>& rule, int& krul, int& neval )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QC25C estimates the principal value of the integral of
+//    F(X)/(X-C) over [A,B].
+//
+//  Discussion:
+//
+//    If C is at least 0.1*(B-A)/2 outside [A,B], RULE is applied to
+//    F(X)/(X-C), and KRUL is decreased by 1.  It is increased again if
+//    the error estimate is RESASC, that is, if the rule saw no
+//    cancellation.
+//
+//    Otherwise F is interpolated by Chebyshev polynomials of degrees 12
+//    and 24 at the points of the 25 point Clenshaw-Curtis rule, and the
+//    products with 1/(X-C) are integrated exactly with modified
+//    Chebyshev moments, computed by forward recursion.  The error is
+//    estimated from the difference of the two.  RESABS and RESASC are
+//    then set to the overflow level.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function &F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint C, the singularity.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule away from C.
+//
+//    Input/output, int &KRUL, counts the uses of RULE, see above.
+//
+//    Output, int &NEVAL, the number of function values.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QC25C, the interval
+//    with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint cc = ( FloatingPoint ( 2 ) * c - b - a ) / ( b - a );
+  FloatingPoint fval[25];
+  FloatingPoint cheb12[13];
+  FloatingPoint cheb24[25];
+  kronrod_interval<FloatingPoint> value;
+
+  if ( FloatingPoint ( 1.1 ) <= scalar::abs ( cc ) )
+  {
+    auto g = [&] ( const FloatingPoint& x )
+    {
+      return f ( x ) / ( x - c );
+    };
+    krul = krul - 1;
+    neval = 2 * rule.n + 1;
+    value = kronrod_qk ( rule, g, a, b );
+    if ( value.resasc == value.error )
+    {
+      krul = krul + 1;
+    }
+    return value;
+  }
+
+  const std::array<FloatingPoint,25>& x = kronrod_qcheb_nodes<FloatingPoint> ( );
+  FloatingPoint centr = ( a + b ) / FloatingPoint ( 2 );
+  FloatingPoint hlgth = ( b - a ) / FloatingPoint ( 2 );
+  neval = 25;
+
+  fval[0] = f ( centr + hlgth ) / FloatingPoint ( 2 );
+  fval[12] = f ( centr );
+  fval[24] = f ( centr - hlgth ) / FloatingPoint ( 2 );
+  for ( int j = 1; j < 12; j++ )
+  {
+    fval[j] = f ( centr + hlgth * x[j] );
+    fval[24-j] = f ( centr - hlgth * x[j] );
+  }
+
+  kronrod_qcheb ( x, fval, cheb12, cheb24 );
+//
+//  AMOM0, AMOM1, AMOM2 are consecutive moments, the integrals of
+//  T(K)(T)/(T-CC) over [-1,1].  They satisfy
+//    M(K+1) = 2*CC*M(K) - M(K-1) + 2 * Integral T(K),
+//  where the integral of T(K) is 2/(1-K*K) for even K, and 0 otherwise.
+//
+  FloatingPoint amom0 = scalar::log ( scalar::abs ( ( FloatingPoint ( 1 ) - cc )
+    / ( FloatingPoint ( 1 ) + cc ) ) );
+  FloatingPoint amom1 = FloatingPoint ( 2 ) + cc * amom0;
+  FloatingPoint res12 = cheb12[0] * amom0 + cheb12[1] * amom1;
+  FloatingPoint res24 = cheb24[0] * amom0 + cheb24[1] * amom1;
+
+  for ( int k = 2; k <= 24; k++ )
+  {
+    FloatingPoint amom2 = FloatingPoint ( 2 ) * cc * amom1 - amom0;
+    if ( k % 2 == 1 )
+    {
+      FloatingPoint ak = FloatingPoint ( k - 1 );
+      amom2 = amom2 - FloatingPoint ( 4 ) / ( ak * ak - FloatingPoint ( 1 ) );
+    }
+    if ( k <= 12 )
+    {
+      res12 = res12 + cheb12[k] * amom2;
+    }
+    res24 = res24 + cheb24[k] * amom2;
+    amom0 = amom1;
+    amom1 = amom2;
+  }
+
+  value.a = a;
+  value.b = b;
+  value.result = res24;
+  value.error = scalar::abs ( res24 - res12 );
+  value.resabs = scalar::max ( );
+  value.resasc = scalar::max ( );
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qawc ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint c, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAWC computes the Cauchy principal value of the integral of
+//    F(X)/(X-C) over [A,B].
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAWC.  The subintervals are integrated by
+//    KRONROD_QC25C, with Clenshaw-Curtis and modified Chebyshev moments
+//    near C and with RULE elsewhere, and the one with the largest error
+//    is bisected.  A subinterval is never split at C itself: if C would
+//    fall in a half, the split point is moved to halve the distance
+//    between C and the other end instead.
+//
+//    IER is 0 if the requested accuracy was reached, 1 if the number of
+//    subintervals reached LIMIT, 2 if roundoff error prevented it, 3 if
+//    the integrand behaves badly at some point, and 6 if C is A or B or
+//    the tolerances are invalid.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand, without the factor 1/(X-C).
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint C, the singularity.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule away from C.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAWC, the principal
+//    value and error estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+  typedef kronrod_interval<FloatingPoint> interval;
+
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint uflow = scalar::min ( );
+  FloatingPoint aa = a;
+  FloatingPoint bb = b;
+  FloatingPoint area;
+  FloatingPoint errbnd;
+  FloatingPoint errmax;
+  FloatingPoint errsum;
+  int ier = 0;
+  int iroff1 = 0;
+  int iroff2 = 0;
+  int krule;
+  int last;
+  int maxerr;
+  int nev;
+  int nrmax;
+
+  kronrod_result<FloatingPoint> value;
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 0;
+
+  if ( c == a || c == b || ( epsabs <= FloatingPoint ( 0 )
+    && epsrel < std::max ( FloatingPoint ( FloatingPoint ( 50 ) * epmach ),
+    FloatingPoint ( 5.0E-29 ) ) ) )
+  {
+    value.ier = 6;
+    return value;
+  }
+
+  if ( b < a )
+  {
+    aa = b;
+    bb = a;
+  }
+
+  limit = std::max ( limit, 1 );
+
+  std::vector<FloatingPoint> alist ( limit + 1 );
+  std::vector<FloatingPoint> blist ( limit + 1 );
+  std::vector<FloatingPoint> rlist ( limit + 1 );
+  std::vector<FloatingPoint> elist ( limit + 1 );
+  std::vector<int> iord ( limit + 1 );
+//
+//  First approximation to the integral.
+//
+  krule = 2;
+  interval first = kronrod_qc25c ( f, aa, bb, c, rule, krule, nev );
+  value.evaluations = nev;
+  value.result = first.result;
+  value.error = first.error;
+  last = 1;
+
+  errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( value.result ) ) );
+  if ( limit == 1 )
+  {
+    ier = 1;
+  }
+  if ( ier == 1 || value.error < std::min ( FloatingPoint (
+    FloatingPoint ( 0.01 ) * scalar::abs ( value.result ) ), errbnd ) )
+  {
+    if ( b < a )
+    {
+      value.result = - value.result;
+    }
+    value.ier = ier;
+    value.intervals = 1;
+    return value;
+  }
+//
+//  Initialization.
+//
+  alist[1] = aa;
+  blist[1] = bb;
+  rlist[1] = value.result;
+  elist[1] = value.error;
+  iord[1] = 1;
+  errmax = value.error;
+  maxerr = 1;
+  area = value.result;
+  errsum = value.error;
+  nrmax = 1;
+//
+//  Main loop.
+//
+  for ( last = 2; last <= limit; last++ )
+  {
+//
+//  Bisect the subinterval with the NRMAX-th largest error estimate,
+//  keeping C away from the split point.
+//
+    FloatingPoint a1 = alist[maxerr];
+    FloatingPoint b1 = ( alist[maxerr] + blist[maxerr] ) / FloatingPoint ( 2 );
+    FloatingPoint b2 = blist[maxerr];
+    if ( c <= b1 && a1 < c )
+    {
+      b1 = ( c + b2 ) / FloatingPoint ( 2 );
+    }
+    if ( b1 < c && c < b2 )
+    {
+      b1 = ( a1 + c ) / FloatingPoint ( 2 );
+    }
+    FloatingPoint a2 = b1;
+
+    krule = 2;
+    interval h1 = kronrod_qc25c ( f, a1, b1, c, rule, krule, nev );
+    value.evaluations = value.evaluations + nev;
+    interval h2 = kronrod_qc25c ( f, a2, b2, c, rule, krule, nev );
+    value.evaluations = value.evaluations + nev;
+    FloatingPoint area1 = h1.result;
+    FloatingPoint error1 = h1.error;
+    FloatingPoint area2 = h2.result;
+    FloatingPoint error2 = h2.error;
+//
+//  Improve previous approximations to integral and error and test for
+//  accuracy.
+//
+    FloatingPoint area12 = area1 + area2;
+    FloatingPoint erro12 = error1 + error2;
+    errsum = errsum + erro12 - errmax;
+    area = area + area12 - rlist[maxerr];
+
+    if ( scalar::abs ( rlist[maxerr] - area12 )
+      < FloatingPoint ( 1.0E-05 ) * scalar::abs ( area12 )
+      && FloatingPoint ( 0.99 ) * errmax <= erro12 && krule == 0 )
+    {
+      iroff1 = iroff1 + 1;
+    }
+    if ( 10 < last && errmax < erro12 && krule == 0 )
+    {
+      iroff2 = iroff2 + 1;
+    }
+
+    rlist[maxerr] = area1;
+    rlist[last] = area2;
+    errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( area ) ) );
+
+    if ( errbnd < errsum )
+    {
+//
+//  Test for roundoff error and eventually set error flag.
+//
+      if ( 6 <= iroff1 && 20 < iroff2 )
+      {
+        ier = 2;
+      }
+//
+//  Set error flag in the case that the number of subintervals equals
+//  LIMIT.
+//
+      if ( last == limit )
+      {
+        ier = 1;
+      }
+//
+//  Set error flag in the case of bad integrand behaviour at a point of
+//  the integration range.
+//
+      if ( std::max ( scalar::abs ( a1 ), scalar::abs ( b2 ) )
+        <= ( FloatingPoint ( 1 ) + FloatingPoint ( 100 ) * epmach )
+        * ( scalar::abs ( a2 ) + FloatingPoint ( 1000 ) * uflow ) )
+      {
+        ier = 3;
+      }
+    }
+//
+//  Append the newly created intervals to the list.
+//
+    if ( error2 <= error1 )
+    {
+      alist[last] = a2;
+      blist[maxerr] = b1;
+      blist[last] = b2;
+      elist[maxerr] = error1;
+      elist[last] = error2;
+    }
+    else
+    {
+      alist[maxerr] = a2;
+      alist[last] = a1;
+      blist[last] = b1;
+      rlist[maxerr] = area2;
+      rlist[last] = area1;
+      elist[maxerr] = error2;
+      elist[last] = error1;
+    }
+
+    kronrod_qpsrt ( limit, last, maxerr, errmax, elist, iord, nrmax );
+
+    if ( ier != 0 || errsum <= errbnd )
+    {
+      break;
+    }
+  }
+//
+//  Compute the final result.
+//
+  last = std::min ( last, limit );
+  value.result = FloatingPoint ( 0 );
+  for ( int k = 1; k <= last; k++ )
+  {
+    value.result = value.result + rlist[k];
+  }
+  value.error = errsum;
+
+  if ( b < a )
+  {
+    value.result = - value.result;
+  }
+
+  value.ier = ier;
+  value.intervals = last;
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+struct kronrod_algebraic_moments
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ALGEBRAIC_MOMENTS holds the modified Chebyshev moments of
+//    KRONROD_QAWS.
+//
+//  Discussion:
+//
+//    For K = 0, ..., 24, with T(K) the Chebyshev polynomials,
+//      RI[K] = Integral ( -1 <= X <= 1 ) (1+X)^ALPHA * T(K)(X) dx,
+//      RJ[K] = Integral ( -1 <= X <= 1 ) (1-X)^BETA * T(K)(X) dx,
+//      RG[K] = Integral ( -1 <= X <= 1 )
+//                (1+X)^ALPHA * log((1+X)/2) * T(K)(X) dx,
+//      RH[K] = Integral ( -1 <= X <= 1 )
+//                (1-X)^BETA * log((1-X)/2) * T(K)(X) dx.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  std::array<FloatingPoint,25> ri;
+  std::array<FloatingPoint,25> rj;
+  std::array<FloatingPoint,25> rg;
+  std::array<FloatingPoint,25> rh;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_qmomo ( const FloatingPoint& alfa, const FloatingPoint& beta,
+  kronrod_algebraic_moments<FloatingPoint>& moments )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QMOMO computes the modified Chebyshev moments of KRONROD_QAWS.
+//
+//  Discussion:
+//
+//    All four sets of KRONROD_ALGEBRAIC_MOMENTS are computed by forward
+//    recurrence, which is stable for them.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, FloatingPoint ALFA, BETA, the exponents, greater than -1.
+//
+//    Output, kronrod_algebraic_moments<FloatingPoint> &MOMENTS, the moments.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  std::array<FloatingPoint,25>& ri = moments.ri;
+  std::array<FloatingPoint,25>& rj = moments.rj;
+  std::array<FloatingPoint,25>& rg = moments.rg;
+  std::array<FloatingPoint,25>& rh = moments.rh;
+
+  FloatingPoint alfp1 = alfa + FloatingPoint ( 1 );
+  FloatingPoint betp1 = beta + FloatingPoint ( 1 );
+  FloatingPoint alfp2 = alfa + FloatingPoint ( 2 );
+  FloatingPoint betp2 = beta + FloatingPoint ( 2 );
+  FloatingPoint ralf = scalar::pow ( FloatingPoint ( 2 ), alfp1 );
+  FloatingPoint rbet = scalar::pow ( FloatingPoint ( 2 ), betp1 );
+//
+//  RI and RJ.
+//
+  ri[0] = ralf / alfp1;
+  rj[0] = rbet / betp1;
+  ri[1] = ri[0] * alfa / alfp2;
+  rj[1] = rj[0] * beta / betp2;
+  for ( int i = 2; i <= 24; i++ )
+  {
+    FloatingPoint an = FloatingPoint ( i );
+    FloatingPoint anm1 = FloatingPoint ( i - 1 );
+    ri[i] = - ( ralf + an * ( an - alfp2 ) * ri[i-1] ) / ( anm1 * ( an + alfp1 ) );
+    rj[i] = - ( rbet + an * ( an - betp2 ) * rj[i-1] ) / ( anm1 * ( an + betp1 ) );
+  }
+//
+//  RG and RH.
+//
+  rg[0] = - ri[0] / alfp1;
+  rg[1] = - ( ralf + ralf ) / ( alfp2 * alfp2 ) - rg[0];
+  rh[0] = - rj[0] / betp1;
+  rh[1] = - ( rbet + rbet ) / ( betp2 * betp2 ) - rh[0];
+  for ( int i = 2; i <= 24; i++ )
+  {
+    FloatingPoint an = FloatingPoint ( i );
+    FloatingPoint anm1 = FloatingPoint ( i - 1 );
+    rg[i] = - ( an * ( an - alfp2 ) * rg[i-1] - an * ri[i-1] + anm1 * ri[i] )
+      / ( anm1 * ( an + alfp1 ) );
+    rh[i] = - ( an * ( an - betp2 ) * rh[i-1] - an * rj[i-1] + anm1 * rj[i] )
+      / ( anm1 * ( an + betp1 ) );
+  }
+//
+//  The recurrences for RJ and RH are those of RI and RG, which gives the
+//  moments of (1+X)^BETA.  T(K)(-X) = (-1)^K T(K)(X) turns them around.
+//
+  for ( int i = 1; i <= 24; i = i + 2 )
+  {
+    rj[i] = - rj[i];
+    rh[i] = - rh[i];
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+class kronrod_algebraic_moment_cache
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ALGEBRAIC_MOMENT_CACHE keeps the moments of KRONROD_QAWS.
+//
+//  Discussion:
+//
+//    KRONROD_QAWS maps every subinterval that touches A or B to [-1,1],
+//    so its moments depend only on the exponents ALPHA and BETA.  Passing
+//    one cache to all the calls with the same exponents computes them
+//    once.
+//
+//    GET may be called from several threads.  Entries are never removed,
+//    so the references it returns stay valid for the life of the cache.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  const kronrod_algebraic_moments<FloatingPoint>& get ( const FloatingPoint& alpha,
+    const FloatingPoint& beta )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+
+    std::pair<FloatingPoint,FloatingPoint> key ( alpha, beta );
+    auto it = moments.find ( key );
+    if ( it == moments.end ( ) )
+    {
+      it = moments.emplace ( key, kronrod_algebraic_moments<FloatingPoint> ( ) ).first;
+      kronrod_qmomo ( alpha, beta, it->second );
+    }
+    return it->second;
+  }
+
+  std::size_t size ( )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+
+    return moments.size ( );
+  }
+
+private:
+
+  std::mutex mtx;
+  std::map<std::pair<FloatingPoint,FloatingPoint>,
+    kronrod_algebraic_moments<FloatingPoint>> moments;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qc25s ( Function& f, const FloatingPoint& a,
+  const FloatingPoint& b, const FloatingPoint& bl, const FloatingPoint& br,
+  const FloatingPoint& alfa, const FloatingPoint& beta,
+  const kronrod_algebraic_moments<FloatingPoint>& moments, int integr,
+  const kronrod_rule<FloatingPoint>& rule, int& neval )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QC25S integrates F times the weight of KRONROD_QAWS over
+//    [BL,BR], a subinterval of [A,B].
+//
+//  Discussion:
+//
+//    If BL is A and the weight is singular there, the factors of the
+//    weight that are regular at A are multiplied into F, the product is
+//    interpolated by Chebyshev polynomials of degrees 12 and 24 at the
+//    points of the 25 point Clenshaw-Curtis rule, and the rest of the
+//    weight is integrated exactly with MOMENTS.  The same is done if BR
+//    is B and the weight is singular there.  Otherwise RULE is applied
+//    to the weighted integrand.
+//
+//    For the Clenshaw-Curtis rule, the error is estimated from the
+//    difference of the two interpolants, and RESABS and RESASC are set
+//    to the overflow level.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function &F, the integrand, without the weight.
+//
+//    Input, FloatingPoint A, B, the interval of the weight.
+//
+//    Input, FloatingPoint BL, BR, the subinterval.
+//
+//    Input, FloatingPoint ALFA, BETA, the exponents.
+//
+//    Input, kronrod_algebraic_moments<FloatingPoint> MOMENTS, the moments
+//    for ALFA and BETA.
+//
+//    Input, int INTEGR, the weight, as for KRONROD_QAWS.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule away from A and B.
+//
+//    Output, int &NEVAL, the number of function values.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QC25S, the interval
+//    with its estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  bool log_a = ( integr == 2 || integr == 4 );
+  bool log_b = ( integr == 3 || integr == 4 );
+  bool left = ( bl == a && ( alfa != FloatingPoint ( 0 ) || log_a ) );
+  bool right = ( br == b && ( beta != FloatingPoint ( 0 ) || log_b ) );
+  FloatingPoint fval[25];
+  FloatingPoint cheb12[13];
+  FloatingPoint cheb24[25];
+  kronrod_interval<FloatingPoint> value;
+
+  if ( !left && !right )
+  {
+    auto g = [&] ( const FloatingPoint& x )
+    {
+      FloatingPoint xa = x - a;
+      FloatingPoint bx = b - x;
+      FloatingPoint wx = scalar::pow ( xa, alfa ) * scalar::pow ( bx, beta );
+      if ( log_a )
+      {
+        wx = wx * scalar::log ( xa );
+      }
+      if ( log_b )
+      {
+        wx = wx * scalar::log ( bx );
+      }
+      return f ( x ) * wx;
+    };
+    neval = 2 * rule.n + 1;
+    return kronrod_qk ( rule, g, bl, br );
+  }
+//
+//  With X = CENTR + HLGTH * T, the weight is a product of a factor
+//  singular at the end T = S, which the moments integrate, and a factor
+//  regular there, a function of the distance FIX + S * HLGTH * T to the
+//  other end of [A,B].
+//
+  const std::array<FloatingPoint,25>& x = kronrod_qcheb_nodes<FloatingPoint> ( );
+  FloatingPoint centr = ( br + bl ) / FloatingPoint ( 2 );
+  FloatingPoint hlgth = ( br - bl ) / FloatingPoint ( 2 );
+  FloatingPoint s = left ? FloatingPoint ( -1 ) : FloatingPoint ( 1 );
+  FloatingPoint fix = left ? b - centr : centr - a;
+  FloatingPoint power = left ? beta : alfa;
+  bool log_regular = left ? log_b : log_a;
+  bool log_singular = left ? log_a : log_b;
+  const std::array<FloatingPoint,25>& rm = left ? moments.ri : moments.rj;
+  const std::array<FloatingPoint,25>& rl = left ? moments.rg : moments.rh;
+  neval = 25;
+
+  auto regular = [&] ( const FloatingPoint& t )
+  {
+    FloatingPoint d = fix + s * hlgth * t;
+    FloatingPoint wx = scalar::pow ( d, power );
+    if ( log_regular )
+    {
+      wx = wx * scalar::log ( d );
+    }
+    return f ( centr + hlgth * t ) * wx;
+  };
+
+  fval[0] = regular ( FloatingPoint ( 1 ) ) / FloatingPoint ( 2 );
+  fval[12] = regular ( FloatingPoint ( 0 ) );
+  fval[24] = regular ( FloatingPoint ( -1 ) ) / FloatingPoint ( 2 );
+  for ( int j = 1; j < 12; j++ )
+  {
+    fval[j] = regular ( x[j] );
+    fval[24-j] = regular ( - x[j] );
+  }
+
+  kronrod_qcheb ( x, fval, cheb12, cheb24 );
+
+  FloatingPoint res12 = FloatingPoint ( 0 );
+  FloatingPoint res24 = FloatingPoint ( 0 );
+  for ( int k = 0; k <= 24; k++ )
+  {
+    if ( k <= 12 )
+    {
+      res12 = res12 + cheb12[k] * rm[k];
+    }
+    res24 = res24 + cheb24[k] * rm[k];
+  }
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+//
+//  log(distance to the end) = log(BR-BL) + log((1-S*T)/2).
+//
+  if ( log_singular )
+  {
+    FloatingPoint dc = scalar::log ( br - bl );
+    value.result = res24 * dc;
+    value.error = scalar::abs ( ( res24 - res12 ) * dc );
+    res12 = FloatingPoint ( 0 );
+    res24 = FloatingPoint ( 0 );
+    for ( int k = 0; k <= 24; k++ )
+    {
+      if ( k <= 12 )
+      {
+        res12 = res12 + cheb12[k] * rl[k];
+      }
+      res24 = res24 + cheb24[k] * rl[k];
+    }
+  }
+
+  FloatingPoint factor = scalar::pow ( hlgth, FloatingPoint ( left ? alfa : beta )
+    + FloatingPoint ( 1 ) );
+
+  value.a = bl;
+  value.b = br;
+  value.result = ( value.result + res24 ) * factor;
+  value.error = ( value.error + scalar::abs ( res24 - res12 ) ) * factor;
+  value.resabs = scalar::max ( );
+  value.resasc = scalar::max ( );
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_qaws ( Function f, FloatingPoint a,
+  FloatingPoint b, FloatingPoint alfa, FloatingPoint beta, int integr,
+  FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule,
+  kronrod_algebraic_moment_cache<FloatingPoint>& cache, int limit = 50 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QAWS integrates F(X)*W(X) over [A,B], for an algebraic and
+//    logarithmic endpoint weight W.
+//
+//  Discussion:
+//
+//    This is QUADPACK's QAWS.  The weight is
+//      W(X) = (X-A)^ALFA * (B-X)^BETA * V(X),
+//    with V(X) chosen by INTEGR:
+//      1, V(X) = 1;
+//      2, V(X) = log(X-A);
+//      3, V(X) = log(B-X);
+//      4, V(X) = log(X-A) * log(B-X).
+//
+//    The subintervals are integrated by KRONROD_QC25S, with Clenshaw-Curtis
+//    and modified Chebyshev moments at A and B and with RULE elsewhere,
+//    and the one with the largest error is bisected.  The moments are
+//    taken from CACHE.
+//
+//    IER is 0 if the requested accuracy was reached, 1 if the number of
+//    subintervals reached LIMIT, 2 if roundoff error prevented it, 3 if
+//    the integrand behaves badly at some point, and 6 if the input is
+//    invalid: B <= A, ALFA <= -1, BETA <= -1, INTEGR not in 1 to 4, LIMIT
+//    less than 2, or invalid tolerances.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Robert Piessens, Elise de Doncker.
+//    C++ version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Robert Piessens, Elise de Doncker-Kapenga,
+//    Christian Ueberhuber, David Kahaner,
+//    QUADPACK, A Subroutine Package for Automatic Integration,
+//    Springer, 1983.
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand, without the weight.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint ALFA, BETA, the exponents, greater than -1.
+//
+//    Input, int INTEGR, the logarithmic factor, see above.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule away from A and B.
+//
+//    Input/output, kronrod_algebraic_moment_cache<FloatingPoint> &CACHE,
+//    the moments.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_QAWS, the integral
+//    and error estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+  typedef kronrod_interval<FloatingPoint> interval;
+
+  FloatingPoint epmach = scalar::epsilon ( );
+  FloatingPoint uflow = scalar::min ( );
+  FloatingPoint area;
+  FloatingPoint errbnd;
+  FloatingPoint errmax;
+  FloatingPoint errsum;
+  int ier = 0;
+  int iroff1 = 0;
+  int iroff2 = 0;
+  int last;
+  int maxerr;
+  int nev;
+  int nrmax;
+
+  kronrod_result<FloatingPoint> value;
+
+  value.result = FloatingPoint ( 0 );
+  value.error = FloatingPoint ( 0 );
+  value.evaluations = 0;
+  value.intervals = 0;
+
+  if ( b <= a || alfa <= FloatingPoint ( -1 ) || beta <= FloatingPoint ( -1 )
+    || integr < 1 || 4 < integr || limit < 2 || ( epsabs <= FloatingPoint ( 0 )
+    && epsrel < std::max ( FloatingPoint ( FloatingPoint ( 50 ) * epmach ),
+    FloatingPoint ( 5.0E-29 ) ) ) )
+  {
+    value.ier = 6;
+    return value;
+  }
+
+  const kronrod_algebraic_moments<FloatingPoint>& moments = cache.get ( alfa, beta );
+
+  std::vector<FloatingPoint> alist ( limit + 1 );
+  std::vector<FloatingPoint> blist ( limit + 1 );
+  std::vector<FloatingPoint> rlist ( limit + 1 );
+  std::vector<FloatingPoint> elist ( limit + 1 );
+  std::vector<int> iord ( limit + 1 );
+//
+//  Integrate over the two halves, each of which has one singular end.
+//
+  FloatingPoint centre = ( b + a ) / FloatingPoint ( 2 );
+  interval h1 = kronrod_qc25s ( f, a, b, a, centre, alfa, beta, moments, integr, rule, nev );
+  value.evaluations = nev;
+  interval h2 = kronrod_qc25s ( f, a, b, centre, b, alfa, beta, moments, integr, rule, nev );
+  value.evaluations = value.evaluations + nev;
+  last = 2;
+  value.result = h1.result + h2.result;
+  value.error = h1.error + h2.error;
+
+  errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( value.result ) ) );
+
+  if ( h1.error < h2.error )
+  {
+    std::swap ( h1, h2 );
+  }
+  alist[1] = h1.a;
+  blist[1] = h1.b;
+  rlist[1] = h1.result;
+  elist[1] = h1.error;
+  alist[2] = h2.a;
+  blist[2] = h2.b;
+  rlist[2] = h2.result;
+  elist[2] = h2.error;
+  iord[1] = 1;
+  iord[2] = 2;
+
+  if ( limit == 2 )
+  {
+    ier = 1;
+  }
+  if ( value.error <= errbnd || ier == 1 )
+  {
+    value.ier = ier;
+    value.intervals = 2;
+    return value;
+  }
+
+  errmax = elist[1];
+  maxerr = 1;
+  nrmax = 1;
+  area = value.result;
+  errsum = value.error;
+//
+//  Main loop.
+//
+  for ( last = 3; last <= limit; last++ )
+  {
+//
+//  Bisect the subinterval with the largest error estimate.
+//
+    FloatingPoint a1 = alist[maxerr];
+    FloatingPoint b1 = ( alist[maxerr] + blist[maxerr] ) / FloatingPoint ( 2 );
+    FloatingPoint a2 = b1;
+    FloatingPoint b2 = blist[maxerr];
+
+    h1 = kronrod_qc25s ( f, a, b, a1, b1, alfa, beta, moments, integr, rule, nev );
+    value.evaluations = value.evaluations + nev;
+    h2 = kronrod_qc25s ( f, a, b, a2, b2, alfa, beta, moments, integr, rule, nev );
+    value.evaluations = value.evaluations + nev;
+    FloatingPoint area1 = h1.result;
+    FloatingPoint error1 = h1.error;
+    FloatingPoint area2 = h2.result;
+    FloatingPoint error2 = h2.error;
+//
+//  Improve previous approximations to integral and error and test for
+//  accuracy.
+//
+    FloatingPoint area12 = area1 + area2;
+    FloatingPoint erro12 = error1 + error2;
+    errsum = errsum + erro12 - errmax;
+    area = area + area12 - rlist[maxerr];
+//
+//  Test for roundoff error, away from the ends.
+//
+    if ( a != a1 && b != b2 && h1.resasc != error1 && h2.resasc != error2 )
+    {
+      if ( scalar::abs ( rlist[maxerr] - area12 )
+        < FloatingPoint ( 1.0E-05 ) * scalar::abs ( area12 )
+        && FloatingPoint ( 0.99 ) * errmax <= erro12 )
+      {
+        iroff1 = iroff1 + 1;
+      }
+      if ( 10 < last && errmax < erro12 )
+      {
+        iroff2 = iroff2 + 1;
+      }
+    }
+
+    rlist[maxerr] = area1;
+    rlist[last] = area2;
+    errbnd = std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( area ) ) );
+
+    if ( errbnd < errsum )
+    {
+//
+//  Set error flag in the case that the number of subintervals equals
+//  LIMIT.
+//
+      if ( last == limit )
+      {
+        ier = 1;
+      }
+//
+//  Set error flag in the case of roundoff error.
+//
+      if ( 6 <= iroff1 || 20 <= iroff2 )
+      {
+        ier = 2;
+      }
+//
+//  Set error flag in the case of bad integrand behaviour at interior
+//  points of the integration range.
+//
+      if ( std::max ( scalar::abs ( a1 ), scalar::abs ( b2 ) )
+        <= ( FloatingPoint ( 1 ) + FloatingPoint ( 100 ) * epmach )
+        * ( scalar::abs ( a2 ) + FloatingPoint ( 1000 ) * uflow ) )
+      {
+        ier = 3;
+      }
+    }
+//
+//  Append the newly created intervals to the list.
+//
+    if ( error2 <= error1 )
+    {
+      alist[last] = a2;
+      blist[maxerr] = b1;
+      blist[last] = b2;
+      elist[maxerr] = error1;
+      elist[last] = error2;
+    }
+    else
+    {
+      alist[maxerr] = a2;
+      alist[last] = a1;
+      blist[last] = b1;
+      rlist[maxerr] = area2;
+      rlist[last] = area1;
+      elist[maxerr] = error2;
+      elist[last] = error1;
+    }
+
+    kronrod_qpsrt ( limit, last, maxerr, errmax, elist, iord, nrmax );
+
+    if ( ier != 0 || errsum <= errbnd )
+    {
+      break;
+    }
+  }
+//
+//  Compute the final result.
+//
+  last = std::min ( last, limit );
+  value.result = FloatingPoint ( 0 );
+  for ( int k = 1; k <= last; k++ )
+  {
+    value.result = value.result + rlist[k];
+  }
+  value.error = errsum;
+  value.ier = ier;
+  value.intervals = last;
+
+  return value;
+}
+//****************************************************************************80
@@ -0,0 +1,952 @@
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+#include <utility>
+
+#include "kronrod_integrateT.hpp"
+
+template <typename FloatingPoint>
+struct kronrod_weighted_rule
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_WEIGHTED_RULE holds a Gauss rule for a weight function and its
+//    Kronrod extension.
+//
+//  Discussion:
+//
+//    The rule approximates the integral of W(X) F(X) over the support of
+//    the weight W.  Such a rule is not symmetric in general, so all 2*N+1
+//    abscissas are kept, in increasing order.  W1 holds the weights of
+//    the Gauss-Kronrod rule and W2 those of the Gauss rule, 0 at the
+//    Kronrod abscissas.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int n = 0;
+  std::vector<FloatingPoint> x;
+  std::vector<FloatingPoint> w1;
+  std::vector<FloatingPoint> w2;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_imtqlx ( int n, FloatingPoint d[], FloatingPoint e[], FloatingPoint z[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_IMTQLX diagonalizes a symmetric tridiagonal matrix.
+//
+//  Discussion:
+//
+//    This routine is a slightly modified version of the EISPACK routine to
+//    perform the implicit QL algorithm on a symmetric tridiagonal matrix.
+//
+//    The authors thank the authors of EISPACK for permission to use this
+//    routine.
+//
+//    It has been modified to produce the product Q' * Z, where Z is an
+//    input vector and Q is the orthogonal matrix diagonalizing the input
+//    matrix.  The changes consist (essentially) of applying the
+//    orthogonal transformations directly to Z as they are generated.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Original FORTRAN77 version by Sylvan Elhay, Jaroslav Kautsky.
+//    C++ version by John Burkardt.
+//    This version by Okwuchukwu Nwobi.
+//
+//  Reference:
+//
+//    Sylvan Elhay, Jaroslav Kautsky,
+//    Algorithm 655: IQPACK, FORTRAN Subroutines for the Weights of
+//    Interpolatory Quadrature,
+//    ACM Transactions on Mathematical Software,
+//    Volume 13, Number 4, December 1987, pages 399-415.
+//
+//    Roger Martin, James Wilkinson,
+//    The Implicit QL Algorithm,
+//    Numerische Mathematik,
+//    Volume 12, Number 5, December 1968, pages 377-383.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the matrix.
+//
+//    Input/output, FloatingPoint D[N], the diagonal entries of the matrix.
+//    On output, the information in D has been overwritten.
+//
+//    Input/output, FloatingPoint E[N], the subdiagonal entries of the
+//    matrix, in entries E[0] through E[N-2].  On output, the information
+//    in E has been overwritten.
+//
+//    Input/output, FloatingPoint Z[N].  On input, a vector.  On output,
+//    the value of Q' * Z, where Q is the matrix that diagonalizes the
+//    input symmetric tridiagonal matrix.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint b;
+  FloatingPoint c;
+  FloatingPoint f;
+  FloatingPoint g;
+  int i;
+  int ii;
+  int itn = 30;
+  int j;
+  int k;
+  int l;
+  int m = n;
+  int mml;
+  FloatingPoint p;
+  FloatingPoint prec;
+  FloatingPoint r;
+  FloatingPoint s;
+
+  prec = scalar::epsilon ( );
+
+  if ( n == 1 )
+  {
+    return;
+  }
+
+  e[n-1] = FloatingPoint ( 0 );
+
+  for ( l = 1; l <= n; l++ )
+  {
+    j = 0;
+    for ( ; ; )
+    {
+      for ( m = l; m <= n; m++ )
+      {
+        if ( m == n )
+        {
+          break;
+        }
+
+        if ( scalar::abs ( e[m-1] ) <= prec * ( scalar::abs ( d[m-1] ) + scalar::abs ( d[m] ) ) )
+        {
+          break;
+        }
+      }
+      p = d[l-1];
+      if ( m == l )
+      {
+        break;
+      }
+      if ( itn <= j )
+      {
+        std::cout << "\n";
+        std::cout << "KRONROD_IMTQLX - Fatal error!\n";
+        std::cout << "  Iteration limit exceeded\n";
+        exit ( 1 );
+      }
+      j = j + 1;
+      g = ( d[l] - p ) / ( FloatingPoint ( 2 ) * e[l-1] );
+      r = scalar::sqrt ( g * g + FloatingPoint ( 1 ) );
+      g = d[m-1] - p + e[l-1] / ( g + ( g < FloatingPoint ( 0 ) ? - r : r ) );
+      s = FloatingPoint ( 1 );
+      c = FloatingPoint ( 1 );
+      p = FloatingPoint ( 0 );
+      mml = m - l;
+
+      for ( ii = 1; ii <= mml; ii++ )
+      {
+        i = m - ii;
+        f = s * e[i-1];
+        b = c * e[i-1];
+
+        if ( scalar::abs ( g ) <= scalar::abs ( f ) )
+        {
+          c = g / f;
+          r = scalar::sqrt ( c * c + FloatingPoint ( 1 ) );
+          e[i] = f * r;
+          s = FloatingPoint ( 1 ) / r;
+          c = c * s;
+        }
+        else
+        {
+          s = f / g;
+          r = scalar::sqrt ( s * s + FloatingPoint ( 1 ) );
+          e[i] = g * r;
+          c = FloatingPoint ( 1 ) / r;
+          s = s * c;
+        }
+        g = d[i] - p;
+        r = ( d[i-1] - g ) * s + FloatingPoint ( 2 ) * c * b;
+        p = s * r;
+        d[i] = g + p;
+        g = c * r - b;
+        f = z[i];
+        z[i] = s * z[i-1] + c * f;
+        z[i-1] = c * z[i-1] - s * f;
+      }
+      d[l-1] = d[l-1] - p;
+      e[l-1] = g;
+      e[m-1] = FloatingPoint ( 0 );
+    }
+  }
+//
+//  Sorting.
+//
+  for ( ii = 2; ii <= m; ii++ )
+  {
+    i = ii - 1;
+    k = i;
+    p = d[i-1];
+
+    for ( j = ii; j <= n; j++ )
+    {
+      if ( d[j-1] < p )
+      {
+         k = j;
+         p = d[j-1];
+      }
+    }
+
+    if ( k != i )
+    {
+      d[k-1] = d[i-1];
+      d[i-1] = p;
+      p = z[i-1];
+      z[i-1] = z[k-1];
+      z[k-1] = p;
+    }
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_golub_welsch ( int n, const FloatingPoint alpha[], const FloatingPoint beta[],
+  std::vector<FloatingPoint>& x, std::vector<FloatingPoint>& w )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_GOLUB_WELSCH computes a Gauss rule from recurrence coefficients.
+//
+//  Discussion:
+//
+//    The abscissas are the eigenvalues of the Jacobi matrix, with ALPHA
+//    on the diagonal and the square roots of BETA[1], ..., BETA[N-1] off
+//    it, and the weights are BETA[0] times the squares of the first
+//    components of the normalized eigenvectors.  BETA[0] is the integral
+//    of the weight function.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Gene Golub, John Welsch,
+//    Calculation of Gaussian Quadrature Rules,
+//    Mathematics of Computation,
+//    Volume 23, Number 106, April 1969, pages 221-230.
+//
+//  Parameters:
+//
+//    Input, int N, the number of abscissas.
+//
+//    Input, FloatingPoint ALPHA[N], BETA[N], the recurrence coefficients,
+//    with BETA[1], ..., BETA[N-1] positive.
+//
+//    Output, std::vector<FloatingPoint>& X, W, the abscissas, in
+//    increasing order, and the weights.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  std::vector<FloatingPoint> e ( n );
+
+  x.assign ( alpha, alpha + n );
+  w.assign ( n, FloatingPoint ( 0 ) );
+  for ( int i = 0; i + 1 < n; i++ )
+  {
+    e[i] = scalar::sqrt ( beta[i+1] );
+  }
+  w[0] = scalar::sqrt ( beta[0] );
+
+  kronrod_imtqlx ( n, x.data ( ), e.data ( ), w.data ( ) );
+
+  for ( int i = 0; i < n; i++ )
+  {
+    w[i] = w[i] * w[i];
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_laurie_scale ( std::vector<FloatingPoint>& s, std::vector<FloatingPoint>& t )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_LAURIE_SCALE rescales the mixed moments of Laurie's algorithm.
+//
+//  Discussion:
+//
+//    The mixed moments shrink like the product of the BETA, by about 4 per
+//    step for the Legendre weight, and would underflow to 0 by N = 550 in
+//    double.  Every update is linear in S and T together, and only their
+//    ratios are used, so both are divided by their largest entry.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input/output, std::vector<FloatingPoint>& S, T, the two rows of
+//    mixed moments.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint big = FloatingPoint ( 0 );
+  for ( std::size_t i = 0; i < s.size ( ); i++ )
+  {
+    if ( big < scalar::abs ( s[i] ) )
+    {
+      big = scalar::abs ( s[i] );
+    }
+    if ( big < scalar::abs ( t[i] ) )
+    {
+      big = scalar::abs ( t[i] );
+    }
+  }
+  if ( FloatingPoint ( 0 ) < big )
+  {
+    for ( std::size_t i = 0; i < s.size ( ); i++ )
+    {
+      s[i] = s[i] / big;
+      t[i] = t[i] / big;
+    }
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+int kronrod_from_recurrence ( int n, const std::vector<FloatingPoint>& alpha,
+  const std::vector<FloatingPoint>& beta, const FloatingPoint& lo,
+  const FloatingPoint& hi, kronrod_weighted_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_FROM_RECURRENCE computes a Gauss-Kronrod rule for any weight.
+//
+//  Discussion:
+//
+//    The monic orthogonal polynomials of the weight satisfy
+//      P(K+1)(X) = ( X - ALPHA[K] ) P(K)(X) - BETA[K] P(K-1)(X),
+//    with BETA[0] the integral of the weight.
+//
+//    Laurie's algorithm finds the recurrence coefficients of the
+//    Jacobi-Kronrod matrix of order 2*N+1 from mixed moments, without
+//    forming the Stieltjes polynomial.  Its eigenvalues are the
+//    abscissas of the Gauss-Kronrod rule, and its eigenvectors give the
+//    weights.  The Gauss rule comes from the first N coefficients.
+//
+//    The rule with real abscissas and positive weights exists exactly
+//    when all the new coefficients BETA are positive.  Even so, some
+//    abscissas may lie outside the support of the weight.  Both are
+//    checked, and reported by the return value:
+//    0, the rule exists, with all abscissas in [LO,HI];
+//    1, ALPHA or BETA is too short, or N < 1;
+//    2, some BETA of the Jacobi-Kronrod matrix is not positive, so that
+//       some abscissas are complex or some weights negative;
+//    3, some abscissas lie outside [LO,HI].
+//    If LO >= HI the support is not checked.  RULE is only set for 0 and 3.
+//
+//    For the Legendre weight this reproduces KRONROD, at the cost of an
+//    eigenvalue problem of order 2*N+1, which KRONROD avoids.  This
+//    routine is for the weights KRONROD cannot do.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Dirk Laurie,
+//    Calculation of Gauss-Kronrod Quadrature Rules,
+//    Mathematics of Computation,
+//    Volume 66, Number 219, July 1997, pages 1133-1145.
+//
+//    Walter Gautschi,
+//    Orthogonal Polynomials: Computation and Approximation,
+//    Oxford, 2004.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, std::vector<FloatingPoint> ALPHA, BETA, the recurrence
+//    coefficients, at least floor(3*N/2)+1 of ALPHA and ceil(3*N/2)+1
+//    of BETA.
+//
+//    Input, FloatingPoint LO, HI, the support of the weight.
+//
+//    Output, kronrod_weighted_rule<FloatingPoint>& RULE, the rule.
+//
+//    Output, int KRONROD_FROM_RECURRENCE, the status, as above.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  if ( n < 1 || int ( alpha.size ( ) ) < ( 3 * n ) / 2 + 1
+    || int ( beta.size ( ) ) < ( 3 * n + 1 ) / 2 + 1 )
+  {
+    return 1;
+  }
+//
+//  A and B hold the coefficients of the Jacobi-Kronrod matrix, from 1.
+//  S and T are the rows of mixed moments, also from 1.
+//
+  std::vector<FloatingPoint> a ( 2 * n + 2, FloatingPoint ( 0 ) );
+  std::vector<FloatingPoint> b ( 2 * n + 2, FloatingPoint ( 0 ) );
+  std::vector<FloatingPoint> s ( n / 2 + 3, FloatingPoint ( 0 ) );
+  std::vector<FloatingPoint> t ( n / 2 + 3, FloatingPoint ( 0 ) );
+
+  for ( int k = 0; k <= ( 3 * n ) / 2; k++ )
+  {
+    a[k+1] = alpha[k];
+  }
+  for ( int k = 0; k <= ( 3 * n + 1 ) / 2; k++ )
+  {
+    b[k+1] = beta[k];
+  }
+
+  t[2] = b[n+2];
+  for ( int m = 0; m <= n - 2; m++ )
+  {
+    FloatingPoint u = FloatingPoint ( 0 );
+    for ( int k = ( m + 1 ) / 2; 0 <= k; k-- )
+    {
+      int l = m - k;
+      u = u + ( a[k+n+2] - a[l+1] ) * t[k+2] + b[k+n+2] * s[k+1] - b[l+1] * s[k+2];
+      s[k+2] = u;
+    }
+    std::swap ( s, t );
+    kronrod_laurie_scale ( s, t );
+  }
+
+  for ( int j = n / 2; 0 <= j; j-- )
+  {
+    s[j+2] = s[j+1];
+  }
+
+  for ( int m = n - 1; m <= 2 * n - 3; m++ )
+  {
+    FloatingPoint u = FloatingPoint ( 0 );
+    int j = 0;
+    for ( int k = m + 1 - n; k <= ( m - 1 ) / 2; k++ )
+    {
+      int l = m - k;
+      j = n - 1 - l;
+      u = u - ( a[k+n+2] - a[l+1] ) * t[j+2] - b[k+n+2] * s[j+2] + b[l+1] * s[j+3];
+      s[j+2] = u;
+    }
+    int k = ( m + 1 ) / 2;
+    if ( m % 2 == 0 )
+    {
+      a[k+n+2] = a[k+1] + ( s[j+2] - b[k+n+2] * s[j+3] ) / t[j+3];
+    }
+    else
+    {
+      b[k+n+2] = s[j+2] / s[j+3];
+    }
+    std::swap ( s, t );
+    kronrod_laurie_scale ( s, t );
+  }
+
+  a[2*n+1] = a[n] - b[2*n+1] * s[2] / t[2];
+
+  for ( int k = 2; k <= 2 * n + 1; k++ )
+  {
+    if ( !( FloatingPoint ( 0 ) < b[k] ) )
+    {
+      return 2;
+    }
+  }
+//
+//  The Gauss-Kronrod and Gauss rules.
+//
+  std::vector<FloatingPoint> xg;
+  std::vector<FloatingPoint> wg;
+  kronrod_golub_welsch ( 2 * n + 1, a.data ( ) + 1, b.data ( ) + 1, rule.x, rule.w1 );
+  kronrod_golub_welsch ( n, alpha.data ( ), beta.data ( ), xg, wg );
+//
+//  Every other Gauss-Kronrod abscissa is a Gauss abscissa.
+//
+  rule.n = n;
+  rule.w2.assign ( 2 * n + 1, FloatingPoint ( 0 ) );
+  for ( int i = 0; i < n; i++ )
+  {
+    rule.x[2*i+1] = xg[i];
+    rule.w2[2*i+1] = wg[i];
+  }
+
+//
+//  Abscissas within rounding of an end, as for the Chebyshev weight,
+//  where the end is an abscissa, are put on it.
+//
+  if ( lo < hi )
+  {
+    FloatingPoint tol = FloatingPoint ( 8 * ( 2 * n + 1 ) ) * scalar::epsilon ( )
+      * ( scalar::abs ( lo ) < scalar::abs ( hi ) ? scalar::abs ( hi ) : scalar::abs ( lo ) );
+    for ( FloatingPoint& x : rule.x )
+    {
+      if ( x < lo - tol || hi + tol < x )
+      {
+        return 3;
+      }
+      x = ( x < lo ) ? lo : ( ( hi < x ) ? hi : x );
+    }
+  }
+
+  return 0;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_discretized_stieltjes ( int m, const std::vector<FloatingPoint>& xs,
+  const std::vector<FloatingPoint>& ws, std::vector<FloatingPoint>& alpha,
+  std::vector<FloatingPoint>& beta )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_DISCRETIZED_STIELTJES computes recurrence coefficients of a
+//    discrete measure.
+//
+//  Discussion:
+//
+//    The measure has masses WS at the points XS.  It usually comes from
+//    a weight function known only by its values, say an empirical
+//    density, times the weights of a fine quadrature rule.  The monic
+//    orthogonal polynomials are generated by their recurrence, and each
+//    coefficient is computed from inner products in the measure, which
+//    is Stieltjes' procedure.
+//
+//    The measure must have more than M points.  The coefficients of a
+//    discretized weight approach those of the weight as the rule is
+//    refined; M should stay well below the number of points.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Walter Gautschi,
+//    Orthogonal Polynomials: Computation and Approximation,
+//    Oxford, 2004.
+//
+//  Parameters:
+//
+//    Input, int M, the number of coefficients wanted.
+//
+//    Input, std::vector<FloatingPoint> XS, WS, the points and masses.
+//
+//    Output, std::vector<FloatingPoint>& ALPHA, BETA, the first M
+//    recurrence coefficients.
+//
+{
+  std::size_t np = xs.size ( );
+  std::vector<FloatingPoint> p0 ( np, FloatingPoint ( 0 ) );
+  std::vector<FloatingPoint> p1 ( np, FloatingPoint ( 1 ) );
+  FloatingPoint norm0 = FloatingPoint ( 1 );
+
+  alpha.assign ( m, FloatingPoint ( 0 ) );
+  beta.assign ( m, FloatingPoint ( 0 ) );
+
+  for ( int k = 0; k < m; k++ )
+  {
+    FloatingPoint norm = FloatingPoint ( 0 );
+    FloatingPoint xnorm = FloatingPoint ( 0 );
+    for ( std::size_t i = 0; i < np; i++ )
+    {
+      FloatingPoint t = ws[i] * p1[i] * p1[i];
+      norm = norm + t;
+      xnorm = xnorm + t * xs[i];
+    }
+    alpha[k] = xnorm / norm;
+    beta[k] = ( k == 0 ) ? norm : norm / norm0;
+    norm0 = norm;
+
+    for ( std::size_t i = 0; i < np; i++ )
+    {
+      FloatingPoint p2 = ( xs[i] - alpha[k] ) * p1[i] - beta[k] * p0[i];
+      p0[i] = p1[i];
+      p1[i] = p2;
+    }
+  }
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_interval<FloatingPoint> kronrod_qk_weighted (
+  const kronrod_weighted_rule<FloatingPoint>& rule, Function& f )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_QK_WEIGHTED applies a rule for a weight function.
+//
+//  Discussion:
+//
+//    The rule only holds on the support of its weight, so there is no
+//    interval to map it to.  RESULT is the Gauss-Kronrod sum and ERROR
+//    the difference from the Gauss sum, without the scaling of
+//    KRONROD_QK_ESTIMATE, which assumes the Legendre weight.  A and B
+//    are the first and last abscissas, RESABS the sum of the weights
+//    times |F|, and RESASC is 0.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_weighted_rule<FloatingPoint> RULE, the rule.
+//
+//    Input, Function& F, the function to be multiplied by the weight.
+//
+//    Output, kronrod_interval<FloatingPoint> KRONROD_QK_WEIGHTED, the
+//    estimates.
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  kronrod_sum<FloatingPoint> i1;
+  kronrod_sum<FloatingPoint> i2;
+  kronrod_sum<FloatingPoint> resabs;
+
+  for ( std::size_t i = 0; i < rule.x.size ( ); i++ )
+  {
+    FloatingPoint fx = f ( rule.x[i] );
+    i1.add ( rule.w1[i] * fx );
+    i2.add ( rule.w2[i] * fx );
+    resabs.add ( rule.w1[i] * scalar::abs ( fx ) );
+  }
+
+  kronrod_interval<FloatingPoint> value;
+  value.a = rule.x.front ( );
+  value.b = rule.x.back ( );
+  value.result = i1.value ( );
+  value.error = scalar::abs ( i1.value ( ) - i2.value ( ) );
+  value.resabs = resabs.value ( );
+  value.resasc = FloatingPoint ( 0 );
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+int kronrod_averaged_from_recurrence ( int n, const std::vector<FloatingPoint>& alpha,
+  const std::vector<FloatingPoint>& beta, const FloatingPoint& lo,
+  const FloatingPoint& hi, kronrod_weighted_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_AVERAGED_FROM_RECURRENCE computes the averaged Gauss rule of
+//    any weight.
+//
+//  Discussion:
+//
+//    The anti-Gauss rule of N+1 abscissas has the Jacobi matrix of the
+//    Gauss rule of N+1 abscissas with BETA[N] doubled.  Its error on
+//    polynomials of degree up to 2*N+1 is minus that of the Gauss rule
+//    of N abscissas, so their mean, the averaged Gauss rule, is exact to
+//    degree 2*N+1, and half their difference estimates the error of the
+//    Gauss rule.
+//
+//    The abscissas of the two rules are real and interlace, the anti-Gauss
+//    ones outermost, so the 2*N+1 abscissas of the averaged rule are laid
+//    out like those of a Gauss-Kronrod rule: W1 holds the averaged
+//    weights, all positive, and W2 the Gauss weights, 0 at the anti-Gauss
+//    abscissas.  Unlike the Kronrod extension, this always exists, which
+//    makes it the fallback estimator where KRONROD_FROM_RECURRENCE fails.
+//    It is less accurate: degree 2*N+1 against 3*N+1, so the estimate
+//    from KRONROD_QK_WEIGHTED is close to the actual error of the Gauss
+//    rule rather than a generous bound on it.
+//
+//    The outermost anti-Gauss abscissas can leave the support of some
+//    weights, Jacobi weights with a large exponent among them, which is
+//    reported as by KRONROD_FROM_RECURRENCE:
+//    0, the rule has all abscissas in [LO,HI], or LO >= HI;
+//    1, ALPHA or BETA is too short, or N < 1;
+//    3, some abscissas lie outside [LO,HI].
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Reference:
+//
+//    Dirk Laurie,
+//    Anti-Gaussian Quadrature Formulas,
+//    Mathematics of Computation,
+//    Volume 65, Number 214, April 1996, pages 739-747.
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, std::vector<FloatingPoint> ALPHA, BETA, the recurrence
+//    coefficients, at least N+1 of each.
+//
+//    Input, FloatingPoint LO, HI, the support of the weight.
+//
+//    Output, kronrod_weighted_rule<FloatingPoint>& RULE, the rule.
+//
+//    Output, int KRONROD_AVERAGED_FROM_RECURRENCE, the status, as above.
+//
+{
+  if ( n < 1 || int ( alpha.size ( ) ) < n + 1 || int ( beta.size ( ) ) < n + 1 )
+  {
+    return 1;
+  }
+
+  std::vector<FloatingPoint> xg;
+  std::vector<FloatingPoint> wg;
+  std::vector<FloatingPoint> xa;
+  std::vector<FloatingPoint> wa;
+  std::vector<FloatingPoint> b ( beta.begin ( ), beta.begin ( ) + n + 1 );
+
+  b[n] = FloatingPoint ( 2 ) * b[n];
+  kronrod_golub_welsch ( n, alpha.data ( ), beta.data ( ), xg, wg );
+  kronrod_golub_welsch ( n + 1, alpha.data ( ), b.data ( ), xa, wa );
+
+  rule.n = n;
+  rule.x.resize ( 2 * n + 1 );
+  rule.w1.resize ( 2 * n + 1 );
+  rule.w2.assign ( 2 * n + 1, FloatingPoint ( 0 ) );
+  for ( int i = 0; i <= n; i++ )
+  {
+    rule.x[2*i] = xa[i];
+    rule.w1[2*i] = wa[i] / FloatingPoint ( 2 );
+  }
+  for ( int i = 0; i < n; i++ )
+  {
+    rule.x[2*i+1] = xg[i];
+    rule.w1[2*i+1] = wg[i] / FloatingPoint ( 2 );
+    rule.w2[2*i+1] = wg[i];
+  }
+
+  if ( lo < hi )
+  {
+    for ( const FloatingPoint& x : rule.x )
+    {
+      if ( x < lo || hi < x )
+      {
+        return 3;
+      }
+    }
+  }
+
+  return 0;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+int kronrod_estimator_from_recurrence ( int n, const std::vector<FloatingPoint>& alpha,
+  const std::vector<FloatingPoint>& beta, const FloatingPoint& lo,
+  const FloatingPoint& hi, kronrod_weighted_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_ESTIMATOR_FROM_RECURRENCE computes the best embedded pair
+//    available for a weight.
+//
+//  Discussion:
+//
+//    The Gauss-Kronrod rule is tried first, and if it does not exist, or
+//    if the coefficients do not reach far enough for it, the averaged
+//    Gauss rule is used.  Either way RULE has 2*N+1 abscissas, the Gauss
+//    rule embedded in it, and the layout of KRONROD_WEIGHTED_RULE.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Input, std::vector<FloatingPoint> ALPHA, BETA, the recurrence
+//    coefficients, at least N+1 of each.
+//
+//    Input, FloatingPoint LO, HI, the support of the weight.
+//
+//    Output, kronrod_weighted_rule<FloatingPoint>& RULE, the rule.
+//
+//    Output, int KRONROD_ESTIMATOR_FROM_RECURRENCE, the status of the
+//    Kronrod extension, as for KRONROD_FROM_RECURRENCE, with -1 if the
+//    averaged rule was used and exists, and the status of
+//    KRONROD_AVERAGED_FROM_RECURRENCE if it does not.
+//
+{
+  int status = kronrod_from_recurrence ( n, alpha, beta, lo, hi, rule );
+
+  if ( status == 0 )
+  {
+    return 0;
+  }
+
+  status = kronrod_averaged_from_recurrence ( n, alpha, beta, lo, hi, rule );
+
+  return ( status == 0 ) ? -1 : status;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void kronrod_averaged_gauss ( int n, kronrod_rule<FloatingPoint>& rule )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_AVERAGED_GAUSS computes the averaged Gauss-Legendre rule.
+//
+//  Discussion:
+//
+//    This is KRONROD_AVERAGED_FROM_RECURRENCE for the Legendre weight,
+//    folded into the layout of KRONROD_RULE, so that it can replace the
+//    Gauss-Kronrod rule in KRONROD_QK and KRONROD_INTEGRATE, or stand in
+//    for a nested extension that KRONROD_PATTERSON or KRONROD_LOBATTO
+//    could not find.  The abscissa 0 is a Gauss abscissa for odd N and an
+//    anti-Gauss one for even N.  It is exact to degree 2*N+1.
+//
+//    The QUADPACK error estimate was fitted to Kronrod pairs, whose
+//    higher rule is much better than the Gauss rule.  Here it is only
+//    somewhat better, so the estimate is less pessimistic than usual
+//    about the result, and the tolerance should be set with some margin.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the Gauss rule.
+//
+//    Output, kronrod_rule<FloatingPoint>& RULE, the rule.
+//
+{
+  typedef typename kronrod_generation<FloatingPoint>::type work;
+
+  std::vector<work> alpha ( n + 1, work ( 0 ) );
+  std::vector<work> beta ( n + 1 );
+  beta[0] = work ( 2 );
+  for ( int k = 1; k <= n; k++ )
+  {
+    beta[k] = work ( k * k ) / work ( 4 * k * k - 1 );
+  }
+
+  kronrod_weighted_rule<work> full;
+  kronrod_averaged_from_recurrence ( n, alpha, beta, work ( 0 ), work ( 0 ), full );
+//
+//  Average each abscissa with its mirror image, which fixes the symmetry
+//  the eigenvalue solver only keeps to rounding.
+//
+  kronrod_rule<work> folded;
+  folded.n = n;
+  folded.x.resize ( n + 1 );
+  folded.w1.resize ( n + 1 );
+  folded.w2.resize ( n + 1 );
+  for ( int i = 0; i < n; i++ )
+  {
+    folded.x[i] = ( full.x[2*n-i] - full.x[i] ) / work ( 2 );
+    folded.w1[i] = ( full.w1[2*n-i] + full.w1[i] ) / work ( 2 );
+    folded.w2[i] = ( full.w2[2*n-i] + full.w2[i] ) / work ( 2 );
+  }
+  folded.x[n] = work ( 0 );
+  folded.w1[n] = full.w1[n];
+  folded.w2[n] = full.w2[n];
+
+  if constexpr ( std::is_same<work, FloatingPoint>::value )
+  {
+    rule = folded;
+  }
+  else
+  {
+    rule = kronrod_rule<FloatingPoint> ( folded );
+  }
+
+  return;
+}
+//****************************************************************************80
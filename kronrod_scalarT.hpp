@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#ifdef KRONROD_HAVE_FLOAT128
+#include <quadmath.h>
+#endif
+
+template <typename FloatingPoint>
+struct kronrod_scalar
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_SCALAR collects the arithmetic the Kronrod code needs from a
+//    scalar type.
+//
+//  Discussion:
+//
+//    The templated routines never call FABS, SIN or SQRT unqualified.
+//    They go through this structure instead, so that a scalar type only
+//    has to provide a specialization here to be usable.
+//
+//    The generic version finds the functions through the standard library
+//    or by argument dependent lookup, which covers float, double,
+//    long double, boost::multiprecision::cpp_bin_float_*, cpp_dec_float_*
+//    and mpfr_float.
+//
+//    __float128 has neither std:: overloads nor a std::numeric_limits
+//    specialization in every library, so it is specialized below when
+//    KRONROD_HAVE_FLOAT128 is defined.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  static int digits ( )
+  {
+    return std::numeric_limits<FloatingPoint>::digits;
+  }
+
+  static FloatingPoint epsilon ( )
+  {
+    return std::numeric_limits<FloatingPoint>::epsilon ( );
+  }
+
+  static FloatingPoint min ( )
+  {
+    return ( std::numeric_limits<FloatingPoint>::min ) ( );
+  }
+
+  static FloatingPoint max ( )
+  {
+    return ( std::numeric_limits<FloatingPoint>::max ) ( );
+  }
+
+  static FloatingPoint abs ( const FloatingPoint& x )
+  {
+    using std::fabs;
+    return fabs ( x );
+  }
+
+  static FloatingPoint sqrt ( const FloatingPoint& x )
+  {
+    using std::sqrt;
+    return sqrt ( x );
+  }
+
+  static FloatingPoint sin ( const FloatingPoint& x )
+  {
+    using std::sin;
+    return sin ( x );
+  }
+
+  static FloatingPoint cos ( const FloatingPoint& x )
+  {
+    using std::cos;
+    return cos ( x );
+  }
+
+  static FloatingPoint fma ( const FloatingPoint& x, const FloatingPoint& y,
+    const FloatingPoint& z )
+  {
+    using std::fma;
+    return fma ( x, y, z );
+  }
+
+  static FloatingPoint log ( const FloatingPoint& x )
+  {
+    using std::log;
+    return log ( x );
+  }
+
+  static FloatingPoint pow ( const FloatingPoint& x, const FloatingPoint& y )
+  {
+    using std::pow;
+    return pow ( x, y );
+  }
+
+  static FloatingPoint pi ( )
+  {
+    using std::atan;
+    return FloatingPoint ( 4 ) * atan ( FloatingPoint ( 1 ) );
+  }
+};
+
+#ifdef KRONROD_HAVE_FLOAT128
+
+template <>
+struct kronrod_scalar<__float128>
+{
+  static int digits ( )
+  {
+    return FLT128_MANT_DIG;
+  }
+
+  static __float128 epsilon ( )
+  {
+    return FLT128_EPSILON;
+  }
+
+  static __float128 min ( )
+  {
+    return FLT128_MIN;
+  }
+
+  static __float128 max ( )
+  {
+    return FLT128_MAX;
+  }
+
+  static __float128 abs ( const __float128& x )
+  {
+    return fabsq ( x );
+  }
+
+  static __float128 sqrt ( const __float128& x )
+  {
+    return sqrtq ( x );
+  }
+
+  static __float128 sin ( const __float128& x )
+  {
+    return sinq ( x );
+  }
+
+  static __float128 cos ( const __float128& x )
+  {
+    return cosq ( x );
+  }
+
+  static __float128 fma ( const __float128& x, const __float128& y,
+    const __float128& z )
+  {
+    return fmaq ( x, y, z );
+  }
+
+  static __float128 log ( const __float128& x )
+  {
+    return logq ( x );
+  }
+
+  static __float128 pow ( const __float128& x, const __float128& y )
+  {
+    return powq ( x, y );
+  }
+
+  static __float128 pi ( )
+  {
+    return M_PIq;
+  }
+};
+
+#endif
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <iostream>
+
+#include "kronrod_integrateT.hpp"
+
+template <typename FloatingPoint>
+class kronrod_stream
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_STREAM integrates sampled data in a single pass.
+//
+//  Discussion:
+//
+//    The samples ( X, Y ) are passed to ADD one at a time, with X
+//    strictly increasing.  Each panel between consecutive abscissas is
+//    integrated by applying RULE to the polynomial of degree DEGREE that
+//    interpolates the DEGREE+1 nearest samples, centered on the panel
+//    where the data allow.  Only the last DEGREE+1 samples are kept, and
+//    a panel is integrated as soon as its samples have arrived.  FINISH
+//    integrates the panels left at the end.  DEGREE must be at least 1.
+//
+//    The error of a panel is the difference between the Gauss-Kronrod
+//    and Gauss results, without the rescaling of KRONROD_QK.  It is only
+//    a useful proxy when the Gauss rule is not exact for the interpolant
+//    and the Kronrod rule is, that is, when 2*N-1 < DEGREE <= 3*N+1.
+//    The default, a cubic interpolant with N = 1, satisfies this.  The
+//    result is then the integral of the piecewise interpolant.
+//
+//    If PANEL is given, it is called with each panel as it is completed.
+//
+//    The stream keeps a copy of RULE, so the rule passed in may be a
+//    temporary.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  typedef std::function<void ( const kronrod_interval<FloatingPoint>& )> panel_function;
+
+  explicit kronrod_stream ( const kronrod_rule<FloatingPoint>& rule, int degree = 3,
+    panel_function panel = panel_function ( ) )
+    : rule ( rule ), degree ( degree ), panel ( panel )
+  {
+    if ( degree < 1 )
+    {
+      std::cout << "\n";
+      std::cout << "KRONROD_STREAM - Fatal error!\n";
+      std::cout << "  DEGREE must be at least 1.\n";
+      exit ( 1 );
+    }
+
+    xs.reserve ( degree + 1 );
+    ys.reserve ( degree + 1 );
+    fv.resize ( 2 * rule.n + 1 );
+  }
+
+  void add ( const FloatingPoint& x, const FloatingPoint& y )
+  {
+    if ( count > 0 && !( xs.back ( ) < x ) )
+    {
+      std::cout << "\n";
+      std::cout << "KRONROD_STREAM - Fatal error!\n";
+      std::cout << "  The abscissas must increase strictly.\n";
+      exit ( 1 );
+    }
+
+    if ( int ( xs.size ( ) ) == degree + 1 )
+    {
+      xs.erase ( xs.begin ( ) );
+      ys.erase ( ys.begin ( ) );
+      first = first + 1;
+    }
+    xs.push_back ( x );
+    ys.push_back ( y );
+    count = count + 1;
+//
+//  Panel I, from sample I to I+1, is centered in the samples
+//  I-(DEGREE-1)/2, ..., I-(DEGREE-1)/2+DEGREE, and can be integrated
+//  once the last of them has arrived.  These are then the samples kept.
+//
+    int lead = degree - ( degree - 1 ) / 2;
+    while ( int ( xs.size ( ) ) == degree + 1 && done + lead < count )
+    {
+      integrate ( done );
+    }
+  }
+
+  void finish ( )
+  {
+    while ( done + 1 < count )
+    {
+      integrate ( done );
+    }
+  }
+
+  FloatingPoint result ( ) const
+  {
+    return total.value ( );
+  }
+
+  FloatingPoint error ( ) const
+  {
+    return total_error;
+  }
+
+  int panels ( ) const
+  {
+    return done;
+  }
+
+private:
+
+  void integrate ( int i )
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    int n = rule.n;
+    int m = int ( xs.size ( ) );
+    int j = i - first;
+    FloatingPoint a = xs[j];
+    FloatingPoint b = xs[j+1];
+    FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+    FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+
+    fv[2*n] = interpolate ( m, center );
+    for ( int k = 0; k < n; k++ )
+    {
+      FloatingPoint dx = half * rule.x[k];
+      fv[2*k] = interpolate ( m, center - dx );
+      fv[2*k+1] = interpolate ( m, center + dx );
+    }
+
+    kronrod_interval<FloatingPoint> value = kronrod_qk_sums ( rule, fv, a, b );
+
+    FloatingPoint diff = ( rule.w1[n] - rule.w2[n] ) * fv[2*n];
+    for ( int k = 0; k < n; k++ )
+    {
+      diff = diff + ( rule.w1[k] - rule.w2[k] ) * ( fv[2*k] + fv[2*k+1] );
+    }
+    value.error = scalar::abs ( diff * half );
+
+    total.add ( value.result );
+    total_error = total_error + value.error;
+    done = done + 1;
+
+    if ( panel )
+    {
+      panel ( value );
+    }
+  }
+
+  FloatingPoint interpolate ( int m, const FloatingPoint& x ) const
+  {
+    FloatingPoint value = FloatingPoint ( 0 );
+
+    for ( int k = 0; k < m; k++ )
+    {
+      FloatingPoint l = ys[k];
+      for ( int q = 0; q < m; q++ )
+      {
+        if ( q != k )
+        {
+          l = l * ( x - xs[q] ) / ( xs[k] - xs[q] );
+        }
+      }
+      value = value + l;
+    }
+    return value;
+  }
+
+  kronrod_rule<FloatingPoint> rule;
+  int degree;
+  panel_function panel;
+  std::vector<FloatingPoint> xs;
+  std::vector<FloatingPoint> ys;
+  std::vector<FloatingPoint> fv;
+  int first = 0;
+  int count = 0;
+  int done = 0;
+  kronrod_sum<FloatingPoint> total;
+  FloatingPoint total_error = FloatingPoint ( 0 );
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+
+struct kronrod_table
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TABLE is a Gauss-Kronrod rule in double compiled into the program.
+//
+//  Discussion:
+//
+//    The tables are written by the KRONROD_TABLES program at build time,
+//    into the header KRONROD_TABLES.HPP, for the orders listed in the
+//    CMake cache variable KRONROD_TABLE_ORDERS.  X, W1 and W2 have N+1
+//    entries laid out as in KRONROD_RULE, each the double nearest to the
+//    value computed in cpp_bin_float_50.  That costs nothing at run time
+//    and is better than generating in double, which loses up to about
+//    4.0E-13 in the relative accuracy of the outermost weights at N = 30.
+//
+//    CHECKSUM is KRONROD_TABLE_CHECKSUM of the values the generator
+//    rounded, and the header checks it against the values the compiler
+//    read back from the literals with STATIC_ASSERT, so a table that was
+//    edited or mangled does not compile.
+//
+//    The targets built with the tables have KRONROD_HAVE_TABLES defined
+//    and the header on their include path, and there KRONROD_RULE<double>
+//    copies a table rather than generating the rule, as does
+//    KRONROD_RULE<float> through it.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int n;
+  const double* x;
+  const double* w1;
+  const double* w2;
+  std::uint64_t checksum;
+};
+//****************************************************************************80
+
+constexpr std::uint64_t kronrod_table_checksum ( int n, const double x[],
+  const double w1[], const double w2[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TABLE_CHECKSUM hashes the bits of a rule.
+//
+//  Discussion:
+//
+//    This is the 64 bit FNV-1a hash of the bytes of X, W1 and W2, in that
+//    order, each double taken as its IEEE bit pattern from the least
+//    significant byte up, so the result does not depend on the byte order
+//    of the machine.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, int N, the order of the rule.
+//
+//    Input, double X[N+1], W1[N+1], W2[N+1], the rule.
+//
+//    Output, std::uint64_t KRONROD_TABLE_CHECKSUM, the hash.
+//
+{
+  std::uint64_t hash = 14695981039346656037ull;
+  const double* arrays[3] = { x, w1, w2 };
+
+  for ( const double* a : arrays )
+  {
+    for ( int i = 0; i <= n; i++ )
+    {
+      std::uint64_t bits = std::bit_cast<std::uint64_t> ( a[i] );
+      for ( int k = 0; k < 8; k++ )
+      {
+        hash = ( hash ^ ( ( bits >> ( 8 * k ) ) & 0xffu ) ) * 1099511628211ull;
+      }
+    }
+  }
+
+  return hash;
+}
+//****************************************************************************80
+
+template <std::size_t M>
+constexpr const kronrod_table* kronrod_table_search (
+  const kronrod_table ( &tables )[M], int n )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TABLE_SEARCH finds the table of order N.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, kronrod_table TABLES[M], the tables.
+//
+//    Input, int N, the order.
+//
+//    Output, const kronrod_table* KRONROD_TABLE_SEARCH, the table, or
+//    null if there is none of order N.
+//
+{
+  for ( const kronrod_table& table : tables )
+  {
+    if ( table.n == n )
+    {
+      return &table;
+    }
+  }
+  return nullptr;
+}
+//****************************************************************************80
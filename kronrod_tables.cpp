@@ -0,0 +1,117 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include "kronrodT.hpp"
+#include "kronrod_tableT.hpp"
+
+// Writes the header of precomputed double rules that KRONROD_HAVE_TABLES
+// builds use:
+//
+//   kronrod_tables <output header> <order> <order> ...
+//
+// Each rule is generated in cpp_bin_float_50 and every value rounded to
+// the nearest double.  The literals are written in hexadecimal, so the
+// compiler reads back exactly the bits the generator chose; the checksum
+// and static_assert after each table make sure of it.
+
+using namespace boost::multiprecision;
+using FloatingPointType = cpp_bin_float_50;
+
+// The double nearest to v.  The conversion of cpp_bin_float is correctly
+// rounded in recent Boost, but the neighbours are checked anyway, as a
+// table is generated once and used everywhere.
+double nearest(const FloatingPointType& v){
+
+    double d = static_cast<double>(v);
+    for (double e : {std::nextafter(d, -INFINITY), std::nextafter(d, INFINITY)}) {
+        if (abs(FloatingPointType(e) - v) < abs(FloatingPointType(d) - v)) {
+            d = e;
+        }
+    }
+    return d;
+}
+
+void write_array(std::ostream& out, const std::string& name, const std::vector<double>& a){
+
+    out << "alignas ( 64 ) constexpr double " << name << "[" << a.size() << "] = {\n";
+    for (std::size_t i = 0; i < a.size(); i++) {
+        out << "  " << std::hexfloat << a[i] << std::defaultfloat
+            << (i + 1 < a.size() ? "," : "") << "\n";
+    }
+    out << "};\n";
+}
+
+int main(int argc, char** argv){
+
+    if (argc < 3) {
+        std::cerr << "usage: kronrod_tables <output header> <order> <order> ...\n";
+        return 1;
+    }
+
+    std::vector<int> orders;
+    for (int i = 2; i < argc; i++) {
+        int n = std::atoi(argv[i]);
+        if (n < 1) {
+            std::cerr << "kronrod_tables: bad order " << argv[i] << "\n";
+            return 1;
+        }
+        orders.push_back(n);
+    }
+    std::sort(orders.begin(), orders.end());
+    orders.erase(std::unique(orders.begin(), orders.end()), orders.end());
+
+    std::ostringstream out;
+    out << "#pragma once\n\n"
+        << "// Generated by kronrod_tables from kronrod<cpp_bin_float_50>.  Do not edit.\n\n"
+        << "#include \"kronrod_tableT.hpp\"\n\n";
+
+    std::vector<std::uint64_t> checksums;
+    for (int n : orders) {
+        auto [x, w1, w2] = kronrod<FloatingPointType>(n);
+        std::vector<double> xd(n + 1), w1d(n + 1), w2d(n + 1);
+        for (int i = 0; i <= n; i++) {
+            xd[i] = nearest(x[i]);
+            w1d[i] = nearest(w1[i]);
+            w2d[i] = nearest(w2[i]);
+        }
+        std::uint64_t checksum = kronrod_table_checksum(n, xd.data(), w1d.data(), w2d.data());
+        checksums.push_back(checksum);
+
+        std::string s = std::to_string(n);
+        write_array(out, "kronrod_table_x_" + s, xd);
+        write_array(out, "kronrod_table_w1_" + s, w1d);
+        write_array(out, "kronrod_table_w2_" + s, w2d);
+        out << "static_assert ( kronrod_table_checksum ( " << n
+            << ", kronrod_table_x_" << s << ", kronrod_table_w1_" << s
+            << ", kronrod_table_w2_" << s << " ) == 0x"
+            << std::hex << checksum << std::dec << "ull,\n"
+            << "  \"kronrod_tables.hpp: table of order " << n << " does not match its checksum\" );\n\n";
+    }
+
+    out << "constexpr kronrod_table kronrod_tables[" << orders.size() << "] = {\n";
+    for (std::size_t k = 0; k < orders.size(); k++) {
+        std::string s = std::to_string(orders[k]);
+        out << "  { " << s << ", kronrod_table_x_" << s << ", kronrod_table_w1_" << s
+            << ", kronrod_table_w2_" << s << ", 0x" << std::hex << checksums[k] << std::dec
+            << "ull }" << (k + 1 < orders.size() ? "," : "") << "\n";
+    }
+    out << "};\n\n"
+        << "constexpr const kronrod_table* kronrod_table_find ( int n )\n"
+        << "{\n"
+        << "  return kronrod_table_search ( kronrod_tables, n );\n"
+        << "}\n";
+
+    std::ofstream file(argv[1]);
+    file << out.str();
+    if (!file) {
+        std::cerr << "kronrod_tables: cannot write " << argv[1] << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -2,10 +2,36 @@
 # include <iostream>
 # include <iomanip>
 # include <cmath>
+# include <string>
+# include <deque>
+# include <functional>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <future>
+# include <chrono>
+# include <algorithm>
+
+# include <boost/multiprecision/cpp_bin_float.hpp>
+# include <boost/multiprecision/cpp_dec_float.hpp>
+# ifdef KRONROD_HAVE_MPFR
+# include <boost/multiprecision/mpfr.hpp>
+# endif
 
 using namespace std;
 
 # include "kronrodT.hpp"
+# include "kronrod_integrateT.hpp"
+# include "kronrod_quadpackT.hpp"
+# include "kronrod_cubatureT.hpp"
+# include "kronrod_vectorT.hpp"
+# include "kronrod_streamT.hpp"
+# include "kronrod_asyncT.hpp"
+# include "kronrod_memoT.hpp"
+# include "kronrod_tuneT.hpp"
+# include "kronrod_batchT.hpp"
+# include "kronrod_nestedT.hpp"
+# include "kronrod_recurrenceT.hpp"
 
 // update text to check that there a zero for the final element of x
 
@@ -13,6 +39,29 @@ int main ( );
 void test01 ( );
 void test02 ( );
 void test03 ( );
+void test04 ( );
+template <typename FloatingPoint>
+void test04_type ( string name, int n );
+void test05 ( );
+void test06 ( );
+void test07 ( );
+void test08 ( );
+void test09 ( );
+void test10 ( );
+void test11 ( );
+void test12 ( );
+void test13 ( );
+void test14 ( );
+void test15 ( );
+void test16 ( );
+void test17 ( );
+void test18 ( );
+void test19 ( );
+void test20 ( );
+void test21 ( );
+void test22 ( );
+void test23 ( );
+void test24 ( );
 double f ( double x );
 
 //****************************************************************************80
@@ -51,6 +100,27 @@ int main ( )
   test01 ( );
   test02 ( );
   test03 ( );
+  test04 ( );
+  test05 ( );
+  test06 ( );
+  test07 ( );
+  test08 ( );
+  test09 ( );
+  test10 ( );
+  test11 ( );
+  test12 ( );
+  test13 ( );
+  test14 ( );
+  test15 ( );
+  test16 ( );
+  test17 ( );
+  test18 ( );
+  test19 ( );
+  test20 ( );
+  test21 ( );
+  test22 ( );
+  test23 ( );
+  test24 ( );
 //
 //  Terminate.
 //
@@ -398,6 +468,2205 @@ void test03 ( )
 }
 //****************************************************************************80
 
+void test04 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST04 runs the templated code with each supported scalar type.
+//
+//  Discussion:
+//
+//    Each rule is compared with one computed in cpp_bin_float_100.
+//    The errors should be a small multiple of the epsilon of the type.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  using namespace boost::multiprecision;
+
+  int n = 10;
+
+  cout << "\n";
+  cout << "TEST04\n";
+  cout << "  Compute the rule of order " << n << " in several scalar types\n";
+  cout << "  and compare with a 100 digit computation.\n";
+  cout << "\n";
+  cout << "  Type                  Epsilon      Max X error   Max W error\n";
+  cout << "\n";
+
+  test04_type<float> ( "float", n );
+  test04_type<double> ( "double", n );
+  test04_type<long double> ( "long double", n );
+# ifdef KRONROD_HAVE_FLOAT128
+  test04_type<__float128> ( "__float128", n );
+# endif
+  test04_type<cpp_bin_float_quad> ( "cpp_bin_float_quad", n );
+  test04_type<cpp_bin_float_50> ( "cpp_bin_float_50", n );
+  test04_type<cpp_dec_float_50> ( "cpp_dec_float_50", n );
+# ifdef KRONROD_HAVE_MPFR
+  test04_type<mpfr_float_50> ( "mpfr_float_50", n );
+# endif
+
+  return;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+void test04_type ( string name, int n )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST04_TYPE prints the errors of one scalar type for TEST04.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, string NAME, the name of the type.
+//
+//    Input, int N, the order of the Gauss rule.
+//
+{
+  using boost::multiprecision::cpp_bin_float_100;
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  auto [x, w1, w2] = kronrod<FloatingPoint> ( n );
+
+  cpp_bin_float_100 eps_ref = cpp_bin_float_100 ( 1.0E-50 );
+  auto [xr, w1r, w2r] = kronrod<cpp_bin_float_100> ( n, eps_ref );
+
+  cpp_bin_float_100 xerr = 0;
+  cpp_bin_float_100 werr = 0;
+  for ( int i = 0; i <= n; i++ )
+  {
+    xerr = max ( xerr, cpp_bin_float_100 ( abs ( cpp_bin_float_100 ( x[i] ) - xr[i] ) ) );
+    werr = max ( werr, cpp_bin_float_100 ( abs ( cpp_bin_float_100 ( w1[i] ) - w1r[i] ) ) );
+    werr = max ( werr, cpp_bin_float_100 ( abs ( cpp_bin_float_100 ( w2[i] ) - w2r[i] ) ) );
+  }
+
+  cout << "  " << setw(20) << left << name << right
+       << "  " << setw(12) << static_cast<double> ( scalar::epsilon ( ) )
+       << "  " << setw(12) << static_cast<double> ( xerr )
+       << "  " << setw(12) << static_cast<double> ( werr ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test05 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST05 generates rules repeatedly into caller storage.
+//
+//  Discussion:
+//
+//    The orders 1, 3, 7, 15 and 31 of TEST03 are generated into the
+//    same arrays with one workspace.  After the first pass, the storage
+//    of the workspace should not move, and the rules should agree with
+//    those returned in vectors.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int i;
+  int n;
+  int n_max = 31;
+  int pass;
+  double *b_data = 0;
+  bool moved = false;
+  double diff = 0.0;
+  kronrod_workspace<double> work;
+  vector<double> x ( n_max + 1 );
+  vector<double> w1 ( n_max + 1 );
+  vector<double> w2 ( n_max + 1 );
+
+  cout << "\n";
+  cout << "TEST05\n";
+  cout << "  Generate rules into caller storage with a reused workspace.\n";
+
+  work.reserve ( n_max );
+
+  for ( pass = 1; pass <= 2; pass++ )
+  {
+    for ( n = 1; n <= n_max; n = 2 * n + 1 )
+    {
+      span<double> xs ( x.data ( ), n + 1 );
+      span<double> w1s ( w1.data ( ), n + 1 );
+      span<double> w2s ( w2.data ( ), n + 1 );
+
+      kronrod<double> ( n, kronrod_eps<double> ( ), work, xs, w1s, w2s );
+
+      if ( b_data == 0 )
+      {
+        b_data = work.b.data ( );
+      }
+      moved = moved || ( b_data != work.b.data ( ) );
+
+      auto [xv, w1v, w2v] = kronrod<double> ( n );
+      for ( i = 0; i <= n; i++ )
+      {
+        diff = max ( diff, fabs ( xv[i] - x[i] ) );
+        diff = max ( diff, fabs ( w1v[i] - w1[i] ) );
+        diff = max ( diff, fabs ( w2v[i] - w2[i] ) );
+      }
+    }
+  }
+
+  cout << "\n";
+  cout << "  Workspace storage moved: " << ( moved ? "yes" : "no" ) << "\n";
+  cout << "  Maximum difference from the vector version: " << diff << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test06 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST06 computes large rules, serially and on several threads.
+//
+//  Discussion:
+//
+//    The abscissas should decrease strictly, so that the Gauss and Kronrod
+//    abscissas interlace, the Gauss-Kronrod weights should sum to 2, and
+//    the threaded computation should give exactly the serial result.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int i;
+  int n;
+  int n_test[3] = { 1, 255, 2000 };
+  int test;
+
+  cout << "\n";
+  cout << "TEST06\n";
+  cout << "  Compute large rules serially and with 4 threads.\n";
+  cout << "\n";
+  cout << "         N  Interlaced   Sum(WK) - 2    Sum(WG) - 2   Threaded diff\n";
+  cout << "\n";
+
+  for ( test = 0; test < 3; test++ )
+  {
+    n = n_test[test];
+
+    vector<double> x ( n + 1 );
+    vector<double> w1 ( n + 1 );
+    vector<double> w2 ( n + 1 );
+    vector<double> xt ( n + 1 );
+    vector<double> w1t ( n + 1 );
+    vector<double> w2t ( n + 1 );
+    kronrod_workspace<double> work;
+
+    kronrod<double> ( n, kronrod_eps<double> ( ), work, x, w1, w2 );
+    kronrod<double> ( n, kronrod_eps<double> ( ), work, xt, w1t, w2t, 4 );
+
+    bool interlaced = true;
+    double sum1 = w1[n];
+    double sum2 = w2[n];
+    double diff = 0.0;
+    for ( i = 0; i < n; i++ )
+    {
+      interlaced = interlaced && ( x[i+1] < x[i] );
+      sum1 = sum1 + 2.0 * w1[i];
+      sum2 = sum2 + 2.0 * w2[i];
+    }
+    for ( i = 0; i <= n; i++ )
+    {
+      diff = max ( diff, fabs ( x[i] - xt[i] ) );
+      diff = max ( diff, fabs ( w1[i] - w1t[i] ) );
+      diff = max ( diff, fabs ( w2[i] - w2t[i] ) );
+    }
+
+    cout << "  " << setw(8) << n
+         << "  " << setw(10) << ( interlaced ? "yes" : "no" )
+         << "  " << setw(13) << sum1 - 2.0
+         << "  " << setw(13) << sum2 - 2.0
+         << "  " << setw(13) << diff << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test07 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST07 integrates a peaked function adaptively, serially and in
+//    parallel.
+//
+//  Discussion:
+//
+//    The integrand 1 / ( ( x - 0.3 )^2 + 0.0001 ) on [0,1] needs many
+//    subdivisions.  The parallel runs bisect 16 subintervals per round.
+//    Their results should not depend on the number of threads.
+//
+//    Last, the integral of EXP(X*Y) over the unit square is done as an
+//    integral of integrals, with one type of integrand for both levels,
+//    so that the inner calls run while the outer ones are in progress.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double exact = 100.0 * ( atan ( 70.0 ) + atan ( 30.0 ) );
+  kronrod_rule<double> rule ( 7 );
+  auto g = [] ( double x ) { return 1.0 / ( ( x - 0.3 ) * ( x - 0.3 ) + 0.0001 ); };
+
+  cout << "\n";
+  cout << "TEST07\n";
+  cout << "  Adaptive integration with the 7 point Gauss rule\n";
+  cout << "  and its 15 point Kronrod extension.\n";
+  cout << "\n";
+  cout << "  Threads  Batch   Intervals  Evaluations        Estimate"
+       << "      Error est.    Actual error\n";
+  cout << "\n";
+
+  int threads_test[3] = { 1, 1, 4 };
+  int batch_test[3] = { 1, 16, 16 };
+
+  for ( int test = 0; test < 3; test++ )
+  {
+    kronrod_result<double> r = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-10,
+      rule, 1000, threads_test[test], batch_test[test] );
+
+    cout << "  " << setw(7) << threads_test[test]
+         << "  " << setw(5) << batch_test[test]
+         << "  " << setw(10) << r.intervals
+         << "  " << setw(11) << r.evaluations
+         << "  " << setw(14) << setprecision(12) << r.result
+         << "  " << setw(14) << setprecision(6) << r.error
+         << "  " << setw(14) << fabs ( r.result - exact ) << "\n";
+  }
+
+  std::function<double ( double )> outer = [&rule] ( double x )
+  {
+    std::function<double ( double )> inner = [x] ( double y ) { return exp ( x * y ); };
+    return kronrod_integrate ( inner, 0.0, 1.0, 0.0, 1.0E-12, rule ).result;
+  };
+  kronrod_result<double> r = kronrod_integrate ( outer, 0.0, 1.0, 0.0, 1.0E-12, rule );
+
+  cout << "\n";
+  cout << "  Nested integral of EXP(X*Y) over the unit square:\n";
+  cout << "  IER = " << r.ier
+       << ", error " << fabs ( r.result - 1.3179021514544038 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test08 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST08 integrates functions with endpoint singularities, with and
+//    without extrapolation.
+//
+//  Discussion:
+//
+//    log(x) and 1/sqrt(x) on [0,1] have the integrals -1 and 2.  Plain
+//    bisection refines towards X = 0 until the interval is tiny, while
+//    KRONROD_QAGS extrapolates the sequence of estimates, and should
+//    need far fewer evaluations.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  kronrod_rule<double> rule ( 10 );
+  auto g1 = [] ( double x ) { return log ( x ); };
+  auto g2 = [] ( double x ) { return 1.0 / sqrt ( x ); };
+
+  cout << "\n";
+  cout << "TEST08\n";
+  cout << "  Integrate log(x) and 1/sqrt(x) on [0,1] with KRONROD_INTEGRATE\n";
+  cout << "  and with KRONROD_QAGS, using the 21 point Kronrod rule.\n";
+  cout << "\n";
+  cout << "  F          Method     IER  Intervals  Evaluations"
+       << "      Error est.    Actual error\n";
+  cout << "\n";
+
+  auto row = [] ( string name, string method, kronrod_result<double> r, double exact )
+  {
+    cout << "  " << setw(9) << left << name
+         << "  " << setw(9) << method << right
+         << "  " << setw(3) << r.ier
+         << "  " << setw(9) << r.intervals
+         << "  " << setw(11) << r.evaluations
+         << "  " << setw(14) << setprecision(6) << r.error
+         << "  " << setw(14) << fabs ( r.result - exact ) << "\n";
+  };
+
+  row ( "log(x)", "integrate",
+    kronrod_integrate ( g1, 0.0, 1.0, 0.0, 1.0E-10, rule ), -1.0 );
+  row ( "log(x)", "qags",
+    kronrod_qags ( g1, 0.0, 1.0, 0.0, 1.0E-10, rule ), -1.0 );
+  row ( "1/sqrt(x)", "integrate",
+    kronrod_integrate ( g2, 0.0, 1.0, 0.0, 1.0E-10, rule ), 2.0 );
+  row ( "1/sqrt(x)", "qags",
+    kronrod_qags ( g2, 0.0, 1.0, 0.0, 1.0E-10, rule ), 2.0 );
+
+  return;
+}
+//****************************************************************************80
+
+void test09 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST09 integrates over infinite intervals.
+//
+//  Discussion:
+//
+//    The last integral is the upper tail probability of the standard
+//    normal distribution at 2.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double pi = 3.141592653589793;
+  kronrod_infinite_rule<double> rule ( 7 );
+
+  cout << "\n";
+  cout << "TEST09\n";
+  cout << "  Integrate over infinite intervals with KRONROD_QAGI,\n";
+  cout << "  using the 15 point Kronrod rule.\n";
+  cout << "\n";
+  cout << "  Integral                   IER  Intervals  Evaluations"
+       << "      Error est.    Actual error\n";
+  cout << "\n";
+
+  auto row = [] ( string name, kronrod_result<double> r, double exact )
+  {
+    cout << "  " << setw(25) << left << name << right
+         << "  " << setw(3) << r.ier
+         << "  " << setw(9) << r.intervals
+         << "  " << setw(11) << r.evaluations
+         << "  " << setw(14) << setprecision(6) << r.error
+         << "  " << setw(14) << fabs ( r.result - exact ) << "\n";
+  };
+
+  row ( "exp(-x), (0,+oo)",
+    kronrod_qagi ( [] ( double x ) { return exp ( -x ); },
+    0.0, 1, 0.0, 1.0E-10, rule ), 1.0 );
+  row ( "exp(x), (-oo,0)",
+    kronrod_qagi ( [] ( double x ) { return exp ( x ); },
+    0.0, -1, 0.0, 1.0E-10, rule ), 1.0 );
+  row ( "1/(1+x^2), (-oo,+oo)",
+    kronrod_qagi ( [] ( double x ) { return 1.0 / ( 1.0 + x * x ); },
+    0.0, 2, 0.0, 1.0E-10, rule ), pi );
+  row ( "normal pdf, (2,+oo)",
+    kronrod_qagi ( [=] ( double x ) { return exp ( -x * x / 2.0 ) / sqrt ( 2.0 * pi ); },
+    2.0, 1, 0.0, 1.0E-10, rule ), erfc ( sqrt ( 2.0 ) ) / 2.0 );
+
+  return;
+}
+//****************************************************************************80
+
+void test10 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST10 integrates over boxes with adaptive cubature.
+//
+//  Discussion:
+//
+//    The integrand is a narrow Gaussian peak at ( 0.3, ..., 0.3 ) in the
+//    unit cube, in 2, 3 and 4 dimensions, so that its integral is the
+//    DIM-th power of a one dimensional integral.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double pi = 3.141592653589793;
+  double exact1 = sqrt ( pi ) / 20.0 * ( erf ( 7.0 ) + erf ( 3.0 ) );
+  kronrod_rule<double> rule ( 3 );
+
+  auto peak = [] ( span<const double> x )
+  {
+    double r2 = 0.0;
+    for ( double xi : x )
+    {
+      r2 = r2 + ( xi - 0.3 ) * ( xi - 0.3 );
+    }
+    return exp ( - 100.0 * r2 );
+  };
+
+  cout << "\n";
+  cout << "TEST10\n";
+  cout << "  Integrate a Gaussian peak over the unit cube with KRONROD_HCUBATURE,\n";
+  cout << "  using the tensor product of the 7 point Kronrod rule\n";
+  cout << "  and the Genz-Malik rule.\n";
+  cout << "\n";
+  cout << "  Dim  Rule          IER    Regions  Evaluations"
+       << "      Error est.  Relative error\n";
+  cout << "\n";
+
+  for ( int dim = 2; dim <= 4; dim++ )
+  {
+    vector<double> a ( dim, 0.0 );
+    vector<double> b ( dim, 1.0 );
+    double exact = pow ( exact1, dim );
+    kronrod_tensor_rule<double> tensor ( rule, dim );
+    kronrod_genz_malik_rule<double> genz_malik ( dim );
+
+    auto row = [&] ( string name, kronrod_result<double> r )
+    {
+      cout << "  " << setw(3) << dim
+           << "  " << setw(12) << left << name << right
+           << "  " << setw(3) << r.ier
+           << "  " << setw(9) << r.intervals
+           << "  " << setw(11) << r.evaluations
+           << "  " << setw(14) << setprecision(6) << r.error
+           << "  " << setw(14) << fabs ( r.result - exact ) / exact << "\n";
+    };
+
+    row ( "tensor", kronrod_hcubature<double> ( kronrod_batch<double> ( peak, dim ),
+      a, b, 0.0, 1.0E-06, tensor, 100000 ) );
+    row ( "genz-malik", kronrod_hcubature<double> ( kronrod_batch<double> ( peak, dim ),
+      a, b, 0.0, 1.0E-06, genz_malik, 100000 ) );
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test11 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST11 integrates a vector of functions over one subdivision.
+//
+//  Discussion:
+//
+//    The components are the moments X^K * F(X), K = 0, ..., 19, of the
+//    peaked F of TEST07, so that F is evaluated once per abscissa for all
+//    of them.  The separate runs of KRONROD_INTEGRATE are shown for
+//    comparison.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int fdim = 20;
+  kronrod_rule<double> rule ( 7 );
+  vector<double> exact ( fdim );
+  string names[3] = { "individual", "l2", "linf" };
+  kronrod_norm norms[3] = { kronrod_norm::individual, kronrod_norm::l2, kronrod_norm::linf };
+
+  auto peak = [] ( double x ) { return 1.0 / ( ( x - 0.3 ) * ( x - 0.3 ) + 0.0001 ); };
+  auto moments = [&] ( double x, span<double> fx )
+  {
+    double v = peak ( x );
+    for ( int k = 0; k < fdim; k++ )
+    {
+      fx[k] = v;
+      v = v * x;
+    }
+  };
+
+  cout << "\n";
+  cout << "TEST11\n";
+  cout << "  Integrate " << fdim << " moments of a peaked function with\n";
+  cout << "  KRONROD_INTEGRATE_VECTOR, under each error norm, and\n";
+  cout << "  with separate calls of KRONROD_INTEGRATE.\n";
+  cout << "\n";
+  cout << "  Norm         IER  Intervals  Evaluations  Max relative error\n";
+  cout << "\n";
+
+  int evaluations = 0;
+  for ( int k = 0; k < fdim; k++ )
+  {
+    auto g = [&] ( double x ) { return pow ( x, k ) * peak ( x ); };
+    kronrod_result<double> r = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-13, rule );
+    exact[k] = r.result;
+    evaluations = evaluations + r.evaluations;
+  }
+
+  for ( int test = 0; test < 3; test++ )
+  {
+    kronrod_vector_result<double> r = kronrod_integrate_vector ( moments, fdim,
+      0.0, 1.0, 0.0, 1.0E-10, rule, norms[test] );
+
+    double err = 0.0;
+    for ( int k = 0; k < fdim; k++ )
+    {
+      err = max ( err, fabs ( r.result[k] - exact[k] ) / fabs ( exact[k] ) );
+    }
+
+    cout << "  " << setw(10) << left << names[test] << right
+         << "  " << setw(3) << r.ier
+         << "  " << setw(9) << r.intervals
+         << "  " << setw(11) << r.evaluations
+         << "  " << setw(18) << setprecision(6) << err << "\n";
+  }
+
+  cout << "  " << setw(10) << left << "separate" << right
+       << "  " << setw(3) << "-"
+       << "  " << setw(9) << "-"
+       << "  " << setw(11) << evaluations << "  (tolerance 1.0E-13)\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test12 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST12 integrates streamed samples of a function.
+//
+//  Discussion:
+//
+//    SIN(X) is sampled at M unevenly spaced points of [0,PI], where its
+//    integral is 2.  The samples are passed one at a time to
+//    KRONROD_STREAM, which uses cubic interpolants and the 3 point
+//    Kronrod rule.  The error estimate should follow the actual error.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double pi = 3.141592653589793;
+  kronrod_rule<double> rule ( 1 );
+
+  cout << "\n";
+  cout << "TEST12\n";
+  cout << "  Integrate streamed samples of sin(x) on [0,pi].\n";
+  cout << "\n";
+  cout << "         M    Panels     Max panel error     Error est.    Actual error\n";
+  cout << "\n";
+
+  for ( int m = 11; m <= 1001; m = 10 * ( m - 1 ) + 1 )
+  {
+    double panel_error = 0.0;
+    kronrod_stream<double> stream ( rule, 3,
+      [&] ( const kronrod_interval<double>& p ) { panel_error = max ( panel_error, p.error ); } );
+
+    for ( int i = 0; i < m; i++ )
+    {
+      double t = double ( i ) / double ( m - 1 );
+      double x = pi * t * ( 1.0 + t ) / 2.0;
+      stream.add ( x, sin ( x ) );
+    }
+    stream.finish ( );
+
+    cout << "  " << setw(8) << m
+         << "  " << setw(8) << stream.panels ( )
+         << "  " << setw(18) << setprecision(6) << panel_error
+         << "  " << setw(13) << stream.error ( )
+         << "  " << setw(14) << fabs ( stream.result ( ) - 2.0 ) << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test13 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST13 integrates oscillatory functions with KRONROD_QAWO and
+//    KRONROD_QAWF.
+//
+//  Discussion:
+//
+//    The integral of exp(-X)*cos(OMEGA*X) over [0,1] is the real part of
+//    ( 1 - exp(-Z) ) / Z, with Z = 1 - i*OMEGA.  KRONROD_INTEGRATE is
+//    shown for comparison.  The moments are shared by all the calls
+//    through one cache.
+//
+//    The integrals of cos(PI*X/2)/sqrt(X) and exp(-X)*cos(3*X) over
+//    ( 0, +oo ) are 1 and 1/10.  The Clenshaw-Curtis rule uses the end
+//    points, so the first integrand is set to 0 at X = 0.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double pi = 3.141592653589793;
+  kronrod_rule<double> rule ( 7 );
+  kronrod_moment_cache<double> cache;
+
+  auto g = [] ( double x ) { return exp ( - x ); };
+
+  cout << "\n";
+  cout << "TEST13\n";
+  cout << "  Integrate exp(-x)*cos(omega*x) on [0,1] with KRONROD_QAWO\n";
+  cout << "  and with KRONROD_INTEGRATE.\n";
+  cout << "\n";
+  cout << "     Omega  IER  QAWO evals  Actual error   INTEGRATE evals  Actual error\n";
+  cout << "\n";
+
+  for ( double omega = 1.0; omega <= 10000.0; omega = omega * 10.0 )
+  {
+    double re = ( 1.0 - exp ( -1.0 ) * cos ( omega ) ) / ( 1.0 + omega * omega );
+    double im = exp ( -1.0 ) * sin ( omega ) / ( 1.0 + omega * omega );
+    double exact = re + omega * im;
+    auto h = [&] ( double x ) { return exp ( - x ) * cos ( omega * x ); };
+
+    kronrod_result<double> r1 = kronrod_qawo ( g, 0.0, 1.0, omega, 1, 0.0, 1.0E-10,
+      rule, cache );
+    kronrod_result<double> r2 = kronrod_integrate ( h, 0.0, 1.0, 0.0, 1.0E-10,
+      rule, 10000 );
+
+    cout << "  " << setw(8) << omega
+         << "  " << setw(3) << r1.ier
+         << "  " << setw(10) << r1.evaluations
+         << "  " << setw(12) << setprecision(6) << fabs ( r1.result - exact )
+         << "  " << setw(15) << r2.evaluations
+         << "  " << setw(12) << fabs ( r2.result - exact ) << "\n";
+  }
+
+  size_t moment_sets = cache.size ( );
+  for ( double omega = 1.0; omega <= 10000.0; omega = omega * 10.0 )
+  {
+    kronrod_qawo ( g, 0.0, 1.0, omega, 1, 0.0, 1.0E-10, rule, cache );
+  }
+
+  cout << "\n";
+  cout << "  Moment sets after the first pass: " << moment_sets << "\n";
+  cout << "  Moment sets after a second pass:  " << cache.size ( ) << "\n";
+
+  cout << "\n";
+  cout << "  Fourier integrals over (0,+oo) with KRONROD_QAWF.\n";
+  cout << "\n";
+  cout << "  Integral                   IER  Evaluations      Error est.    Actual error\n";
+  cout << "\n";
+
+  kronrod_result<double> r = kronrod_qawf ( [] ( double x ) { return ( 0.0 < x ) ? 1.0 / sqrt ( x ) : 0.0; },
+    0.0, pi / 2.0, 1, 1.0E-08, rule, cache );
+  cout << "  " << setw(25) << left << "cos(pi*x/2)/sqrt(x)" << right
+       << "  " << setw(3) << r.ier
+       << "  " << setw(11) << r.evaluations
+       << "  " << setw(14) << r.error
+       << "  " << setw(14) << fabs ( r.result - 1.0 ) << "\n";
+
+  r = kronrod_qawf ( g, 0.0, 3.0, 1, 1.0E-10, rule, cache );
+  cout << "  " << setw(25) << left << "exp(-x)*cos(3*x)" << right
+       << "  " << setw(3) << r.ier
+       << "  " << setw(11) << r.evaluations
+       << "  " << setw(14) << r.error
+       << "  " << setw(14) << fabs ( r.result - 0.1 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test14 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST14 integrates with Cauchy and algebraic-logarithmic weights.
+//
+//  Discussion:
+//
+//    The principal value of the integral of 1/(X*(5*X^3+6)) over [-1,5]
+//    is log(125/631)/18.
+//
+//    The KRONROD_QAWS integrals over [0,1] are
+//      1/sqrt(X*(1-X))             pi,
+//      log(X)/sqrt(X)              -4,
+//      sqrt(1-X)*log(1-X)          -4/9,
+//      log(X)*log(1-X)             2-pi^2/6.
+//    The last one, with F = cos(3*X), is compared with KRONROD_QAGS
+//    applied to the weighted integrand.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double pi = 3.141592653589793;
+  kronrod_rule<double> rule ( 7 );
+  kronrod_algebraic_moment_cache<double> cache;
+
+  auto one = [] ( double ) { return 1.0; };
+
+  cout << "\n";
+  cout << "TEST14\n";
+  cout << "  Integrate with singular weights, using KRONROD_QAWC and\n";
+  cout << "  KRONROD_QAWS.\n";
+  cout << "\n";
+  cout << "  Integral                  IER  Evaluations      Error est.    Actual error\n";
+  cout << "\n";
+
+  kronrod_result<double> r = kronrod_qawc ( [] ( double x ) { return 1.0 / ( 5.0 * x * x * x + 6.0 ); },
+    -1.0, 5.0, 0.0, 0.0, 1.0E-10, rule );
+  cout << "  " << setw(24) << left << "PV 1/(x*(5x^3+6))" << right
+       << "  " << setw(3) << r.ier
+       << "  " << setw(11) << r.evaluations
+       << "  " << setw(14) << setprecision(6) << r.error
+       << "  " << setw(14) << fabs ( r.result - log ( 125.0 / 631.0 ) / 18.0 ) << "\n";
+
+  struct
+  {
+    const char *name;
+    double alfa;
+    double beta;
+    int integr;
+    double exact;
+  } cases[] =
+  {
+    { "1/sqrt(x*(1-x))", -0.5, -0.5, 1, pi },
+    { "log(x)/sqrt(x)", -0.5, 0.0, 2, -4.0 },
+    { "sqrt(1-x)*log(1-x)", 0.0, 0.5, 3, -4.0 / 9.0 },
+    { "log(x)*log(1-x)", 0.0, 0.0, 4, 2.0 - pi * pi / 6.0 }
+  };
+
+  for ( const auto& c : cases )
+  {
+    r = kronrod_qaws ( one, 0.0, 1.0, c.alfa, c.beta, c.integr, 0.0, 1.0E-10,
+      rule, cache );
+    cout << "  " << setw(24) << left << c.name << right
+         << "  " << setw(3) << r.ier
+         << "  " << setw(11) << r.evaluations
+         << "  " << setw(14) << r.error
+         << "  " << setw(14) << fabs ( r.result - c.exact ) << "\n";
+  }
+
+  auto g = [] ( double x ) { return cos ( 3.0 * x ); };
+  auto h = [] ( double x )
+  {
+    return ( 0.0 < x && x < 1.0 ) ? cos ( 3.0 * x ) * log ( x ) * log ( 1.0 - x ) : 0.0;
+  };
+  kronrod_result<double> r1 = kronrod_qaws ( g, 0.0, 1.0, 0.0, 0.0, 4, 0.0, 1.0E-10,
+    rule, cache );
+  kronrod_result<double> r2 = kronrod_qags ( h, 0.0, 1.0, 0.0, 1.0E-10, rule );
+
+  cout << "\n";
+  cout << "  cos(3x)*log(x)*log(1-x):\n";
+  cout << "    QAWS " << setw(20) << setprecision(14) << r1.result
+       << "  " << setw(5) << r1.evaluations << " evaluations\n";
+  cout << "    QAGS " << setw(20) << r2.result
+       << "  " << setw(5) << r2.evaluations << " evaluations\n";
+  cout << "\n";
+  cout << "  Moment sets in the cache: " << cache.size ( ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test15 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST15 compares the plain and compensated application of the weights.
+//
+//  Discussion:
+//
+//    The function values are random, of size 1000, so that the rounding
+//    error of the weighted sums shows.  Both sums are compared with the
+//    sum of the same products in cpp_bin_float_50.  The compensated sum
+//    should be correctly rounded for every N.
+//
+//    The integral of 1/(X^2+1.005) over [-1,1] by KRONROD_INTEGRATE with
+//    compensated sums is shown as a check of the whole path.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  using boost::multiprecision::cpp_bin_float_50;
+
+  int n_test[4] = { 10, 100, 1000, 4000 };
+  unsigned int seed = 123456789;
+
+  cout << "\n";
+  cout << "TEST15\n";
+  cout << "  Apply the Gauss-Kronrod weights with plain and with compensated\n";
+  cout << "  sums, and compare with the exact sum of the products.\n";
+  cout << "\n";
+  cout << "     N    Plain rel. error    Compensated rel. error\n";
+  cout << "\n";
+
+  for ( int n : n_test )
+  {
+    kronrod_rule<double> rule ( n );
+    std::vector<double> fv ( 2 * n + 1 );
+    for ( double& v : fv )
+    {
+      seed = 1664525 * seed + 1013904223;
+      v = 1000.0 * ( double ( seed ) / 4294967296.0 - 0.5 );
+    }
+
+    cpp_bin_float_50 exact = cpp_bin_float_50 ( rule.w1[n] ) * fv[2*n];
+    for ( int i = 0; i < n; i++ )
+    {
+      exact = exact + cpp_bin_float_50 ( rule.w1[i] ) * fv[2*i]
+        + cpp_bin_float_50 ( rule.w1[i] ) * fv[2*i+1];
+    }
+    double e = exact.convert_to<double> ( );
+
+    kronrod_interval<double> p = kronrod_qk_sums ( rule, fv, -1.0, 1.0 );
+    kronrod_interval<double> c = kronrod_qk_sums ( rule, fv, -1.0, 1.0,
+      kronrod_accumulation::compensated );
+
+    cout << "  " << setw(4) << n
+         << "  " << setw(18) << setprecision(6) << fabs ( p.result - e ) / fabs ( e )
+         << "  " << setw(24) << fabs ( c.result - e ) / fabs ( e ) << "\n";
+  }
+
+  kronrod_rule<double> rule ( 10 );
+  kronrod_result<double> r = kronrod_integrate ( f, -1.0, 1.0, 0.0, 1.0E-14, rule,
+    1000, 1, 1, kronrod_accumulation::compensated );
+  cout << "\n";
+  cout << "  Integral of 1/(x^2+1.005), compensated: " << setprecision(16) << r.result
+       << "  error " << setprecision(6) << fabs ( r.result - 1.5643964440690497731 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+class stand_in_server
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    STAND_IN_SERVER answers requests for F(X) after a fixed latency.
+//
+//  Discussion:
+//
+//    It stands in for a remote model server.  REQUEST returns at once,
+//    and DONE ( F ( X ) ) is called on the server thread LATENCY seconds
+//    later.  Requests are served concurrently: a burst of them all
+//    answer after about one LATENCY.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  typedef std::chrono::steady_clock clock;
+
+  stand_in_server ( double ( *f ) ( double ), double latency )
+    : f ( f ), latency ( std::chrono::duration_cast<clock::duration> (
+      std::chrono::duration<double> ( latency ) ) )
+  {
+    worker = std::thread ( [this] ( ) { serve ( ); } );
+  }
+
+  ~stand_in_server ( )
+  {
+    {
+      std::lock_guard<std::mutex> lock ( mtx );
+      stop = true;
+    }
+    cv.notify_one ( );
+    worker.join ( );
+  }
+
+  void request ( double x, std::function<void ( double )> done )
+  {
+    {
+      std::lock_guard<std::mutex> lock ( mtx );
+      pending.push_back ( { clock::now ( ) + latency, x, done } );
+      count = count + 1;
+    }
+    cv.notify_one ( );
+  }
+
+  int requests ( )
+  {
+    std::lock_guard<std::mutex> lock ( mtx );
+    return count;
+  }
+
+private:
+
+  struct item
+  {
+    clock::time_point due;
+    double x;
+    std::function<void ( double )> done;
+  };
+
+  void serve ( )
+  {
+    std::unique_lock<std::mutex> lock ( mtx );
+    for ( ; ; )
+    {
+      cv.wait ( lock, [this] ( ) { return stop || !pending.empty ( ); } );
+      if ( stop )
+      {
+        return;
+      }
+      clock::time_point due = pending.front ( ).due;
+      if ( clock::now ( ) < due )
+      {
+        cv.wait_until ( lock, due );
+        continue;
+      }
+      item it = pending.front ( );
+      pending.pop_front ( );
+      lock.unlock ( );
+      it.done ( f ( it.x ) );
+      lock.lock ( );
+    }
+  }
+
+  double ( *f ) ( double );
+  clock::duration latency;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<item> pending;
+  int count = 0;
+  bool stop = false;
+  std::thread worker;
+};
+//****************************************************************************80
+
+void test16 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST16 integrates a function served with latency by KRONROD_INTEGRATE
+//    and by KRONROD_INTEGRATE_ASYNC.
+//
+//  Discussion:
+//
+//    Every value of F comes from a STAND_IN_SERVER with a latency of 2
+//    milliseconds.  KRONROD_INTEGRATE waits for each value in turn.
+//    KRONROD_INTEGRATE_ASYNC has all the values of a round in flight at
+//    once, and gives the same result as KRONROD_INTEGRATE with the same
+//    BATCH.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  double latency = 0.002;
+  kronrod_rule<double> rule ( 7 );
+  stand_in_server server ( f, latency );
+
+  auto blocking = [&] ( double x )
+  {
+    std::promise<double> p;
+    std::future<double> v = p.get_future ( );
+    server.request ( x, [&p] ( double y ) { p.set_value ( y ); } );
+    return v.get ( );
+  };
+  auto async = [&] ( double x, std::function<void ( double )> done )
+  {
+    server.request ( x, done );
+  };
+
+  cout << "\n";
+  cout << "TEST16\n";
+  cout << "  Integrate 1/(x^2+1.005) over [-1,1], with every value served\n";
+  cout << "  after " << latency * 1000.0 << " ms, blocking and asynchronously.\n";
+  cout << "\n";
+  cout << "  Method     Batch  Evaluations  Latencies waited  Same as blocking\n";
+  cout << "\n";
+
+  int batch_test[3] = { 1, 4, 16 };
+
+  for ( int batch : batch_test )
+  {
+    auto start = std::chrono::steady_clock::now ( );
+    kronrod_result<double> r1 = kronrod_integrate ( blocking, -1.0, 1.0, 0.0, 1.0E-12,
+      rule, 1000, 1, batch );
+    double t1 = std::chrono::duration<double> ( std::chrono::steady_clock::now ( ) - start ).count ( );
+
+    start = std::chrono::steady_clock::now ( );
+    kronrod_result<double> r2 = kronrod_integrate_async ( async, -1.0, 1.0, 0.0, 1.0E-12,
+      rule, 1000, batch );
+    double t2 = std::chrono::duration<double> ( std::chrono::steady_clock::now ( ) - start ).count ( );
+
+    cout << "  " << setw(8) << left << "blocking" << right
+         << "  " << setw(6) << batch
+         << "  " << setw(11) << r1.evaluations
+         << "  " << setw(16) << int ( t1 / latency + 0.5 ) << "\n";
+    cout << "  " << setw(8) << left << "async" << right
+         << "  " << setw(6) << batch
+         << "  " << setw(11) << r2.evaluations
+         << "  " << setw(16) << int ( t2 / latency + 0.5 )
+         << "  " << setw(16) << ( ( r1.result == r2.result && r1.error == r2.error ) ? "yes" : "no" ) << "\n";
+  }
+
+  cout << "\n";
+  cout << "  Requests served: " << server.requests ( ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test17 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST17 counts the evaluations saved by KRONROD_MEMO.
+//
+//  Discussion:
+//
+//    The integrand counts its calls.  Three uses are shown:
+//    the rules N = 1 to 10 applied to [-1,1] in turn, as in TEST03,
+//    which share the center;
+//    KRONROD_INTEGRATE to 1.0E-06 and then to 1.0E-12, where the second
+//    run starts with the subdivision of the first;
+//    KRONROD_QAWO, whose Clenshaw-Curtis panels share their ends.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int calls = 0;
+  auto g = [&calls] ( double x )
+  {
+    calls = calls + 1;
+    return 1.0 / ( x * x + 1.005 );
+  };
+
+  cout << "\n";
+  cout << "TEST17\n";
+  cout << "  Use KRONROD_MEMO to avoid evaluating F twice at the same X.\n";
+  cout << "\n";
+  cout << "  Use                         Requests   Calls of F    Hits\n";
+  cout << "\n";
+
+  kronrod_memo<double, decltype ( g )> m1 ( g );
+  int requests = 0;
+  for ( int n = 1; n <= 10; n++ )
+  {
+    kronrod_rule<double> rule ( n );
+    kronrod_qk ( rule, m1, -1.0, 1.0 );
+    requests = requests + 2 * n + 1;
+  }
+  cout << "  " << setw(26) << left << "Rules N = 1 to 10" << right
+       << "  " << setw(9) << requests
+       << "  " << setw(11) << calls
+       << "  " << setw(6) << m1.hits ( ) << "\n";
+
+  calls = 0;
+  kronrod_memo<double, decltype ( g )> m2 ( g );
+  kronrod_rule<double> rule ( 7 );
+  kronrod_result<double> r1 = kronrod_integrate ( m2, -1.0, 1.0, 0.0, 1.0E-06, rule );
+  kronrod_result<double> r2 = kronrod_integrate ( m2, -1.0, 1.0, 0.0, 1.0E-12, rule );
+  cout << "  " << setw(26) << left << "Tolerance 1e-6, then 1e-12" << right
+       << "  " << setw(9) << r1.evaluations + r2.evaluations
+       << "  " << setw(11) << calls
+       << "  " << setw(6) << m2.hits ( ) << "\n";
+
+  calls = 0;
+  kronrod_memo<double, decltype ( g )> m3 ( g );
+  kronrod_moment_cache<double> cache;
+  kronrod_result<double> r3 = kronrod_qawo ( m3, 0.0, 10.0, 30.0, 1, 0.0, 1.0E-10,
+    rule, cache );
+  cout << "  " << setw(26) << left << "QAWO, omega = 30" << right
+       << "  " << setw(9) << r3.evaluations
+       << "  " << setw(11) << calls
+       << "  " << setw(6) << m3.hits ( ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test18 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST18 tunes the rule order for two classes of integrand.
+//
+//  Discussion:
+//
+//    A smooth integrand, EXP(C*X) on [0,1], should be done by one rule of
+//    high order, and a peaked one, 1/((X-C)^2+1.0E-04), by bisection with
+//    a rule of low order.  The tuning is saved to a file, read back, and
+//    applied to another member of each class.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  kronrod_rule_cache<double> cache;
+  kronrod_tuning_table table;
+  std::vector<kronrod_tuning> trials;
+  string filename = "kronrod_test18.txt";
+
+  auto smooth = [] ( double c )
+  {
+    return [c] ( double x ) { return exp ( c * x ); };
+  };
+  auto peak = [] ( double c )
+  {
+    return [c] ( double x ) { return 1.0 / ( ( x - c ) * ( x - c ) + 1.0E-04 ); };
+  };
+
+  cout << "\n";
+  cout << "TEST18\n";
+  cout << "  KRONROD_TUNE sweeps the rule orders for a sample integrand,\n";
+  cout << "  and KRONROD_TUNING_TABLE keeps the cheapest.\n";
+  cout << "  EPSREL = 1.0E-12.\n";
+
+  for ( int k = 0; k < 2; k++ )
+  {
+    string name = ( k == 0 ) ? "smooth" : "peak";
+    kronrod_tuning best;
+    if ( k == 0 )
+    {
+      best = kronrod_tune ( smooth ( 1.5 ), 0.0, 1.0, 0.0, 1.0E-12, cache, trials );
+    }
+    else
+    {
+      best = kronrod_tune ( peak ( 0.3 ), 0.0, 1.0, 0.0, 1.0E-12, cache, trials );
+    }
+    table.set ( name, best );
+
+    cout << "\n";
+    cout << "  Class " << name << ":\n";
+    cout << "\n";
+    cout << "       N  Strategy  Converged  Evaluations  Microseconds\n";
+    cout << "\n";
+    for ( const kronrod_tuning& t : trials )
+    {
+      cout << "  " << setw(6) << t.n
+           << "  " << setw(8) << ( t.strategy == kronrod_strategy::global ? "global" : "adaptive" )
+           << "  " << setw(9) << ( t.converged ? "yes" : "no" )
+           << "  " << setw(11) << t.evaluations
+           << "  " << setw(12) << setprecision(4) << 1.0E+06 * t.seconds
+           << ( t.n == best.n ? "  <--" : "" ) << "\n";
+    }
+  }
+
+  if ( !table.save ( filename ) )
+  {
+    cout << "\n";
+    cout << "TEST18 - Fatal error!\n";
+    cout << "  Could not write \"" << filename << "\".\n";
+    exit ( 1 );
+  }
+
+  kronrod_tuning_table loaded;
+  if ( !loaded.load ( filename ) )
+  {
+    cout << "\n";
+    cout << "TEST18 - Fatal error!\n";
+    cout << "  Could not read \"" << filename << "\".\n";
+    exit ( 1 );
+  }
+  remove ( filename.c_str ( ) );
+
+  kronrod_tuning t1;
+  kronrod_tuning t2;
+  loaded.find ( "smooth", t1 );
+  loaded.find ( "peak", t2 );
+  kronrod_result<double> r1 = kronrod_integrate_tuned ( smooth ( 2.0 ), 0.0, 1.0,
+    0.0, 1.0E-12, t1, cache );
+  kronrod_result<double> r2 = kronrod_integrate_tuned ( peak ( 0.7 ), 0.0, 1.0,
+    0.0, 1.0E-12, t2, cache );
+  double exact1 = ( exp ( 2.0 ) - 1.0 ) / 2.0;
+  double exact2 = 100.0 * ( atan ( 30.0 ) + atan ( 70.0 ) );
+
+  cout << "\n";
+  cout << "  Read back and applied to other members of the classes:\n";
+  cout << "\n";
+  cout << "  Class      N  Evaluations  Error\n";
+  cout << "\n";
+  cout << "  smooth  " << setw(4) << t1.n
+       << "  " << setw(11) << r1.evaluations
+       << "  " << setw(10) << fabs ( r1.result - exact1 ) / exact1 << "\n";
+  cout << "  peak    " << setw(4) << t2.n
+       << "  " << setw(11) << r2.evaluations
+       << "  " << setw(10) << fabs ( r2.result - exact2 ) / exact2 << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test19 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST19 checks the float rules and the batch kernel.
+//
+//  Discussion:
+//
+//    The first table gives the largest error of the abscissas and weights
+//    in units of the last place of float, for the rule generated in
+//    float and for KRONROD_RULE<float>, which is generated in double and
+//    rounded.
+//
+//    The second gives the largest relative error of KRONROD_QK_BATCH
+//    over the 1000 intervals [K/1000,K/1000+1], for F = EXP, in float
+//    and double, and the largest difference between the double batch and
+//    KRONROD_QK.  These are the accuracy envelopes quoted in
+//    KRONROD_QK_BATCH.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  using boost::multiprecision::cpp_bin_float_50;
+
+  const int count = 1000;
+  int orders[7] = { 5, 10, 20, 50, 100, 200, 400 };
+
+  auto ulps = [] ( float v, const cpp_bin_float_50& r )
+  {
+    float u = nextafter ( fabs ( static_cast<float> ( r ) ), 1.0F )
+      - fabs ( static_cast<float> ( r ) );
+    if ( u <= 0.0F )
+    {
+      u = nextafter ( 0.0F, 1.0F );
+    }
+    return static_cast<double> ( abs ( cpp_bin_float_50 ( v ) - r ) / u );
+  };
+
+  cout << "\n";
+  cout << "TEST19\n";
+  cout << "  Float rules rounded from double, and KRONROD_QK_BATCH.\n";
+  cout << "\n";
+  cout << "         Max error in ulps of float\n";
+  cout << "     N   generated in float   rounded from double\n";
+  cout << "\n";
+
+  for ( int n : orders )
+  {
+    auto [xf, w1f, w2f] = kronrod<float> ( n );
+    kronrod_rule<float> rule ( n );
+    auto [xr, w1r, w2r] = kronrod<cpp_bin_float_50> ( n );
+
+    double e1 = 0.0;
+    double e2 = 0.0;
+    for ( int i = 0; i <= n; i++ )
+    {
+      e1 = max ( e1, max ( ulps ( xf[i], xr[i] ), max ( ulps ( w1f[i], w1r[i] ), ulps ( w2f[i], w2r[i] ) ) ) );
+      e2 = max ( e2, max ( ulps ( rule.x[i], xr[i] ), max ( ulps ( rule.w1[i], w1r[i] ), ulps ( rule.w2[i], w2r[i] ) ) ) );
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(19) << setprecision(3) << e1
+         << "  " << setw(20) << e2 << "\n";
+  }
+
+  cout << "\n";
+  cout << "         Max relative error, F = EXP on 1000 intervals\n";
+  cout << "     N   float batch   double batch   double batch - KRONROD_QK\n";
+  cout << "\n";
+
+  vector<float> af ( count );
+  vector<float> bf ( count );
+  vector<double> ad ( count );
+  vector<double> bd ( count );
+  for ( int k = 0; k < count; k++ )
+  {
+    ad[k] = double ( k ) / double ( count );
+    bd[k] = ad[k] + 1.0;
+    af[k] = float ( ad[k] );
+    bf[k] = float ( bd[k] );
+  }
+  vector<kronrod_interval<float>> vf ( count );
+  vector<kronrod_interval<double>> vd ( count );
+  auto fexp = [] ( double x ) { return exp ( x ); };
+
+  for ( int n : orders )
+  {
+    kronrod_rule<float> rulef ( n );
+    kronrod_rule<double> ruled ( n );
+
+    kronrod_qk_batch ( rulef, [] ( float x ) { return exp ( x ); },
+      af.data ( ), bf.data ( ), count, vf.data ( ) );
+    kronrod_qk_batch ( ruled, fexp,
+      ad.data ( ), bd.data ( ), count, vd.data ( ) );
+
+    double ef = 0.0;
+    double ed = 0.0;
+    double eq = 0.0;
+    for ( int k = 0; k < count; k++ )
+    {
+      double exact = exp ( double ( af[k] ) ) * ( exp ( double ( bf[k] ) - double ( af[k] ) ) - 1.0 );
+      ef = max ( ef, fabs ( double ( vf[k].result ) - exact ) / exact );
+      exact = exp ( ad[k] ) * expm1 ( bd[k] - ad[k] );
+      ed = max ( ed, fabs ( vd[k].result - exact ) / exact );
+      double q = kronrod_qk ( ruled, fexp, ad[k], bd[k] ).result;
+      eq = max ( eq, fabs ( vd[k].result - q ) / exact );
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(11) << ef
+         << "  " << setw(13) << ed
+         << "  " << setw(26) << eq << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test20 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST20 builds Patterson and Lobatto-Kronrod extensions.
+//
+//  Discussion:
+//
+//    The 4 and 7 point Lobatto-Kronrod pair is compared with the values
+//    of Gander and Gautschi, and the 43 point rule that extends
+//    KRONROD_RULE(10) with the first abscissas of QUADPACK's QNG.  Each
+//    rule is checked to integrate X^K exactly up to its degree.
+//
+//    Then the nested rules are used by the adaptive integrators and by
+//    KRONROD_INTEGRATE_NESTED, and their evaluation counts compared.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  kronrod_rule<double> lobatto4;
+  kronrod_rule<double> patterson10;
+  kronrod_rule<double> patterson21;
+  kronrod_rule<double> lobatto6;
+
+  cout << "\n";
+  cout << "TEST20\n";
+  cout << "  KRONROD_PATTERSON and KRONROD_LOBATTO extend a rule by the\n";
+  cout << "  abscissas of highest degree.\n";
+
+  if ( !kronrod_lobatto ( 4, lobatto4 ) || !kronrod_patterson ( 10, patterson10 )
+    || !kronrod_patterson ( patterson10, patterson21 ) || !kronrod_lobatto ( 6, lobatto6 ) )
+  {
+    cout << "\n";
+    cout << "TEST20 - Fatal error!\n";
+    cout << "  An extension that exists was not found.\n";
+    exit ( 1 );
+  }
+
+  double xl[4] = { 1.0, sqrt ( 2.0 / 3.0 ), 1.0 / sqrt ( 5.0 ), 0.0 };
+  double w1l[4] = { 11.0 / 210.0, 72.0 / 245.0, 125.0 / 294.0, 16.0 / 35.0 };
+  double w2l[4] = { 1.0 / 6.0, 0.0, 5.0 / 6.0, 0.0 };
+  double e = 0.0;
+  for ( int i = 0; i < 4; i++ )
+  {
+    e = max ( e, fabs ( lobatto4.x[i] - xl[i] ) );
+    e = max ( e, fabs ( lobatto4.w1[i] - w1l[i] ) );
+    e = max ( e, fabs ( lobatto4.w2[i] - w2l[i] ) );
+  }
+  cout << "\n";
+  cout << "  Lobatto-Kronrod 4/7, largest difference from Gander-Gautschi: "
+       << e << "\n";
+
+  double x43[2] = { 0.999333360901932081394099323919911,
+                    0.987433402908088869795961478381209 };
+  cout << "  Patterson 43, largest difference from QNG: "
+       << max ( fabs ( patterson10.x[0] - x43[0] ), fabs ( patterson10.x[2] - x43[1] ) ) << "\n";
+
+  cout << "\n";
+  cout << "  Rule                     Points  Degree  Max error up to degree  Error at degree + 2\n";
+  cout << "\n";
+
+  auto exactness = [] ( string name, const kronrod_rule<double>& rule, int degree )
+  {
+    double emax = 0.0;
+    double enext = 0.0;
+    for ( int k = 0; k <= degree + 2; k = k + 2 )
+    {
+      double q = rule.w1[rule.n] * ( k == 0 ? 1.0 : 0.0 );
+      for ( int i = 0; i < rule.n; i++ )
+      {
+        q = q + 2.0 * rule.w1[i] * pow ( rule.x[i], k );
+      }
+      double err = fabs ( q - 2.0 / double ( k + 1 ) );
+      if ( k <= degree )
+      {
+        emax = max ( emax, err );
+      }
+      else
+      {
+        enext = err;
+      }
+    }
+    cout << "  " << setw(23) << left << name << right
+         << "  " << setw(6) << 2 * rule.n + 1
+         << "  " << setw(6) << degree
+         << "  " << setw(22) << emax
+         << "  " << setw(19) << enext << "\n";
+  };
+
+  exactness ( "Lobatto-Kronrod 4/7", lobatto4, 9 );
+  exactness ( "Lobatto-Kronrod 6/11", lobatto6, 15 );
+  exactness ( "Patterson 21/43", patterson10, 64 );
+  exactness ( "Patterson 43/87", patterson21, 130 );
+
+  cout << "\n";
+  cout << "  Evaluations of the adaptive integrators, EPSREL = 1.0E-10:\n";
+  cout << "\n";
+  cout << "  Integrand         K21      P43   L-K 11   L-K 11 shared\n";
+  cout << "\n";
+
+  kronrod_rule<double> k21 ( 10 );
+  auto row = [&] ( string name, auto g, double a, double b )
+  {
+    kronrod_result<double> r1 = kronrod_integrate ( g, a, b, 0.0, 1.0E-10, k21 );
+    kronrod_result<double> r2 = kronrod_integrate ( g, a, b, 0.0, 1.0E-10, patterson10 );
+    kronrod_result<double> r3 = kronrod_integrate ( g, a, b, 0.0, 1.0E-10, lobatto6 );
+    kronrod_result<double> r4 = kronrod_integrate_shared ( g, a, b, 0.0, 1.0E-10, lobatto6 );
+    cout << "  " << setw(14) << left << name << right
+         << "  " << setw(6) << r1.evaluations
+         << "  " << setw(7) << r2.evaluations
+         << "  " << setw(7) << r3.evaluations
+         << "  " << setw(14) << r4.evaluations
+         << "  " << setw(10) << fabs ( r4.result - r1.result ) << "\n";
+  };
+
+  row ( "exp(x)", [] ( double x ) { return exp ( x ); }, 0.0, 1.0 );
+  row ( "peak at 0.3", [] ( double x ) { return 1.0 / ( ( x - 0.3 ) * ( x - 0.3 ) + 1.0E-04 ); }, 0.0, 1.0 );
+  row ( "sqrt(x)", [] ( double x ) { return sqrt ( x ); }, 0.0, 1.0 );
+  row ( "|x-1/3|", [] ( double x ) { return fabs ( x - 1.0 / 3.0 ); }, 0.0, 1.0 );
+
+  cout << "\n";
+  cout << "  KRONROD_INTEGRATE_NESTED with the rules of 21, 43 and 87 points,\n";
+  cout << "  EPSREL = 1.0E-10:\n";
+  cout << "\n";
+  cout << "  Integrand         K21 adaptive   Nested   IER   Error\n";
+  cout << "\n";
+
+  vector<kronrod_rule<double>> sequence = { k21, patterson10, patterson21 };
+  auto nested = [&] ( string name, auto g, double exact )
+  {
+    kronrod_result<double> r1 = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-10, k21 );
+    kronrod_result<double> r2 = kronrod_integrate_nested ( g, 0.0, 1.0, 0.0, 1.0E-10, sequence );
+    cout << "  " << setw(14) << left << name << right
+         << "  " << setw(13) << r1.evaluations
+         << "  " << setw(7) << r2.evaluations
+         << "  " << setw(4) << r2.ier
+         << "  " << setw(10) << fabs ( r2.result - exact ) << "\n";
+  };
+
+  nested ( "exp(x)", [] ( double x ) { return exp ( x ); }, exp ( 1.0 ) - 1.0 );
+  nested ( "1/(1+25x^2)", [] ( double x ) { return 1.0 / ( 1.0 + 25.0 * x * x ); }, atan ( 5.0 ) / 5.0 );
+  nested ( "cos(30x)", [] ( double x ) { return cos ( 30.0 * x ); }, sin ( 30.0 ) / 30.0 );
+  nested ( "sqrt(x)", [] ( double x ) { return sqrt ( x ); }, 2.0 / 3.0 );
+
+  return;
+}
+//****************************************************************************80
+
+void test21 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST21 builds Radau-Kronrod rules, and integrates singular functions
+//    while sharing end values.
+//
+//  Discussion:
+//
+//    For each N, the table shows whether the extension exists, its
+//    smallest weight, and the largest error in the integrals of X^K up to
+//    its degree 3*N-1, and at degree 3*N.  For N = 2 the Radau weights
+//    must be 1/2 and 3/2 at -1 and 1/3.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  cout << "\n";
+  cout << "TEST21\n";
+  cout << "  KRONROD_RADAU extends the Gauss-Radau rule of N abscissas.\n";
+  cout << "\n";
+  cout << "     N  Exists  Smallest weight  Max error to 3N-1  Error at 3N\n";
+  cout << "\n";
+
+  for ( int n = 1; n <= 12; n++ )
+  {
+    kronrod_radau_rule<double> rule;
+    bool ok = kronrod_radau ( n, rule );
+    if ( !ok )
+    {
+      cout << "  " << setw(4) << n << "  " << setw(6) << "no" << "\n";
+      continue;
+    }
+    double wmin = *min_element ( rule.w1.begin ( ), rule.w1.end ( ) );
+    double emax = 0.0;
+    double enext = 0.0;
+    for ( int k = 0; k <= 3 * n; k++ )
+    {
+      double q = 0.0;
+      for ( int i = 0; i < 2 * n; i++ )
+      {
+        q = q + rule.w1[i] * pow ( rule.x[i], k );
+      }
+      double exact = ( k % 2 == 0 ) ? 2.0 / double ( k + 1 ) : 0.0;
+      if ( k < 3 * n )
+      {
+        emax = max ( emax, fabs ( q - exact ) );
+      }
+      else
+      {
+        enext = fabs ( q - exact );
+      }
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(6) << "yes"
+         << "  " << setw(15) << wmin
+         << "  " << setw(17) << emax
+         << "  " << setw(11) << enext << "\n";
+  }
+
+  kronrod_radau_rule<double> radau2;
+  kronrod_radau ( 2, radau2 );
+  double e = 0.0;
+  double xr[4] = { -1.0, 0.0, 1.0 / 3.0, 0.0 };
+  double wr[4] = { 0.5, 0.0, 1.5, 0.0 };
+  for ( int i = 0; i < 4; i++ )
+  {
+    if ( radau2.w2[i] != 0.0 )
+    {
+      int k = ( radau2.x[i] == -1.0 ) ? 0 : 2;
+      e = max ( e, fabs ( radau2.x[i] - xr[k] ) + fabs ( radau2.w2[i] - wr[k] ) );
+    }
+  }
+  cout << "\n";
+  cout << "  Radau 2, difference from -1, 1/3 with weights 1/2, 3/2: " << e << "\n";
+
+  kronrod_rule<double> lobatto;
+  kronrod_radau_rule<double> radau;
+  kronrod_lobatto ( 6, lobatto );
+  kronrod_radau ( 5, radau );
+  kronrod_rule<double> k11 ( 5 );
+
+  cout << "\n";
+  cout << "  Integrals over [0,1], EPSREL = 1.0E-10, Gauss-Kronrod 11 against\n";
+  cout << "  Lobatto-Kronrod 11 inside and Radau-Kronrod 10 at the ends:\n";
+  cout << "\n";
+  cout << "  Integrand    K11 evaluations   Shared evaluations   Error\n";
+  cout << "\n";
+
+  auto row = [&] ( string name, auto g, double exact )
+  {
+    kronrod_result<double> r1 = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-10, k11 );
+    kronrod_result<double> r2 = kronrod_integrate_shared ( g, 0.0, 1.0, 0.0, 1.0E-10,
+      lobatto, radau );
+    cout << "  " << setw(11) << left << name << right
+         << "  " << setw(15) << r1.evaluations
+         << "  " << setw(19) << r2.evaluations
+         << "  " << setw(10) << fabs ( r2.result - exact ) << "\n";
+  };
+
+  row ( "log(x)", [] ( double x ) { return log ( x ); }, -1.0 );
+  row ( "1/sqrt(x)", [] ( double x ) { return 1.0 / sqrt ( x ); }, 2.0 );
+  row ( "log(1-x)", [] ( double x ) { return log ( 1.0 - x ); }, -1.0 );
+  row ( "exp(x)", [] ( double x ) { return exp ( x ); }, exp ( 1.0 ) - 1.0 );
+
+  return;
+}
+//****************************************************************************80
+
+void test22 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST22 builds Gauss-Kronrod rules from recurrence coefficients.
+//
+//  Discussion:
+//
+//    For the Legendre weight the rules must agree with KRONROD, also for
+//    N = 600 to 1024, where the mixed moments of Laurie's algorithm would
+//    underflow without rescaling.  For the Hermite weight, EXP(-X^2) on
+//    the real line, the extension with real abscissas and positive weights
+//    exists here only for N = 1 and 2.
+//    For Jacobi weights it may exist for all N, as for Chebyshev, whose
+//    rules have abscissas at -1 and 1; fail for large N; or have
+//    abscissas outside [-1,1], as for A = -1/2, B = 3/2 and odd N.
+//    Last, the coefficients of EXP(X) on [0,1] are found by discretizing
+//    the weight, and the rule checked on X^K up to its degree 3*N+1.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  const char* status[4] = { "exists", "too few", "complex or negative weight", "exterior" };
+
+  cout << "\n";
+  cout << "TEST22\n";
+  cout << "  KRONROD_FROM_RECURRENCE extends the Gauss rule of any weight.\n";
+  cout << "\n";
+  cout << "  Legendre weight, difference from KRONROD:\n";
+  cout << "\n";
+  cout << "     N  Max abscissa difference  Max weight difference\n";
+  cout << "\n";
+
+  int orders[13] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 600, 800, 1024 };
+  for ( int n : orders )
+  {
+    int m = ( 3 * n + 1 ) / 2 + 1;
+    vector<double> alpha ( m, 0.0 );
+    vector<double> beta ( m );
+    beta[0] = 2.0;
+    for ( int k = 1; k < m; k++ )
+    {
+      beta[k] = double ( k * k ) / double ( 4 * k * k - 1 );
+    }
+    kronrod_weighted_rule<double> rule;
+    kronrod_from_recurrence ( n, alpha, beta, -1.0, 1.0, rule );
+    kronrod_rule<double> k ( n );
+
+    double ex = 0.0;
+    double ew = 0.0;
+    for ( int j = 0; j <= 2 * n; j++ )
+    {
+      int i = ( j <= n ) ? j : 2 * n - j;
+      double x = ( j <= n ) ? - k.x[i] : k.x[i];
+      ex = max ( ex, fabs ( rule.x[j] - x ) );
+      ew = max ( ew, fabs ( rule.w1[j] - k.w1[i] ) + fabs ( rule.w2[j] - k.w2[i] ) );
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(23) << ex
+         << "  " << setw(21) << ew << "\n";
+  }
+
+  cout << "\n";
+  cout << "  Hermite weight:\n";
+  cout << "\n";
+  cout << "     N  Extension\n";
+  cout << "\n";
+
+  for ( int n = 1; n <= 8; n++ )
+  {
+    int m = ( 3 * n + 1 ) / 2 + 1;
+    vector<double> alpha ( m, 0.0 );
+    vector<double> beta ( m );
+    beta[0] = sqrt ( M_PI );
+    for ( int k = 1; k < m; k++ )
+    {
+      beta[k] = double ( k ) / 2.0;
+    }
+    kronrod_weighted_rule<double> rule;
+    int s = kronrod_from_recurrence ( n, alpha, beta, 0.0, 0.0, rule );
+    cout << "  " << setw(4) << n << "  " << status[s] << "\n";
+  }
+
+  cout << "\n";
+  cout << "  Jacobi weight (1-X)^A (1+X)^B, extension for N = 1 to 20\n";
+  cout << "  (y exists, c complex or negative weight, x exterior):\n";
+  cout << "\n";
+
+  double ab[5][2] = { { -0.5, -0.5 }, { 0.5, 1.5 }, { -0.5, 1.5 }, { 0.5, 3.5 },
+    { 3.5, 3.5 } };
+  for ( int p = 0; p < 5; p++ )
+  {
+    double pa = ab[p][0];
+    double pb = ab[p][1];
+    cout << "  A = " << setw(4) << pa << ", B = " << setw(4) << pb << ":  ";
+    for ( int n = 1; n <= 20; n++ )
+    {
+      int m = ( 3 * n + 1 ) / 2 + 1;
+      vector<double> alpha ( m );
+      vector<double> beta ( m );
+      beta[0] = 1.0;
+      for ( int k = 0; k < m; k++ )
+      {
+        double t = 2.0 * k + pa + pb;
+        alpha[k] = ( k == 0 ) ? ( pb - pa ) / ( t + 2.0 )
+          : ( pb * pb - pa * pa ) / ( t * ( t + 2.0 ) );
+        if ( k == 1 )
+        {
+          beta[k] = 4.0 * ( 1.0 + pa ) * ( 1.0 + pb ) / ( t * t * ( t + 1.0 ) );
+        }
+        else if ( 1 < k )
+        {
+          beta[k] = 4.0 * k * ( k + pa ) * ( k + pb ) * ( k + pa + pb )
+            / ( t * t * ( t + 1.0 ) * ( t - 1.0 ) );
+        }
+      }
+      kronrod_weighted_rule<double> rule;
+      int s = kronrod_from_recurrence ( n, alpha, beta, -1.0, 1.0, rule );
+      cout << "y-cx"[s];
+    }
+    cout << "\n";
+  }
+
+  int n = 5;
+  int m = ( 3 * n + 1 ) / 2 + 1;
+  kronrod_rule<double> fine ( 50 );
+  vector<double> xs;
+  vector<double> ws;
+  for ( int j = 0; j <= 2 * fine.n; j++ )
+  {
+    int i = ( j <= fine.n ) ? j : 2 * fine.n - j;
+    double x = 0.5 + 0.5 * ( ( j <= fine.n ) ? - fine.x[i] : fine.x[i] );
+    xs.push_back ( x );
+    ws.push_back ( 0.5 * fine.w1[i] * exp ( x ) );
+  }
+  vector<double> alpha;
+  vector<double> beta;
+  kronrod_discretized_stieltjes ( m, xs, ws, alpha, beta );
+  kronrod_weighted_rule<double> rule;
+  int s = kronrod_from_recurrence ( n, alpha, beta, 0.0, 1.0, rule );
+
+  double emax = 0.0;
+  double enext = 0.0;
+  for ( int k = 0; k <= 3 * n + 2; k++ )
+  {
+    double exact = 0.0;
+    for ( size_t i = 0; i < xs.size ( ); i++ )
+    {
+      exact = exact + ws[i] * pow ( xs[i], k );
+    }
+    auto g = [k] ( double x ) { return pow ( x, k ); };
+    kronrod_interval<double> q = kronrod_qk_weighted ( rule, g );
+    if ( k <= 3 * n + 1 )
+    {
+      emax = max ( emax, fabs ( q.result - exact ) );
+    }
+    else
+    {
+      enext = fabs ( q.result - exact );
+    }
+  }
+  cout << "\n";
+  cout << "  EXP(X) on [0,1], discretized by Gauss-Kronrod 101, N = " << n << ":\n";
+  cout << "  extension " << status[s]
+       << ", max error to degree 3N+1 " << emax
+       << ", error at 3N+2 " << enext << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test23 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST23 uses averaged Gauss rules where Kronrod rules are missing.
+//
+//  Discussion:
+//
+//    For the Legendre weight, the averaged rule must be exact to degree
+//    2*N+1, and is then used in KRONROD_INTEGRATE in place of the
+//    Gauss-Kronrod rule of the same order.  For the Hermite weight, where
+//    the Kronrod extension fails for N = 3 on, the fallback must give
+//    every N a rule exact to degree 2*N+1.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  cout << "\n";
+  cout << "TEST23\n";
+  cout << "  KRONROD_AVERAGED_GAUSS averages the Gauss and anti-Gauss rules.\n";
+  cout << "\n";
+  cout << "     N  Max error to 2N+1  Error at 2N+2\n";
+  cout << "\n";
+
+  for ( int n = 1; n <= 10; n++ )
+  {
+    kronrod_rule<double> rule;
+    kronrod_averaged_gauss ( n, rule );
+    double emax = 0.0;
+    double enext = 0.0;
+    for ( int k = 0; k <= 2 * n + 2; k += 2 )
+    {
+      double q = rule.w1[n] * ( ( k == 0 ) ? 1.0 : 0.0 );
+      for ( int i = 0; i < n; i++ )
+      {
+        q = q + 2.0 * rule.w1[i] * pow ( rule.x[i], k );
+      }
+      double e = fabs ( q - 2.0 / double ( k + 1 ) );
+      if ( k <= 2 * n + 1 )
+      {
+        emax = max ( emax, e );
+      }
+      else
+      {
+        enext = e;
+      }
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(17) << emax
+         << "  " << setw(13) << enext << "\n";
+  }
+
+  cout << "\n";
+  cout << "  Integrals over [0,1], EPSREL = 1.0E-10, with N = 10:\n";
+  cout << "\n";
+  cout << "  Integrand    Rule       Evaluations       Error    Estimate\n";
+  cout << "\n";
+
+  kronrod_rule<double> k21 ( 10 );
+  kronrod_rule<double> a21;
+  kronrod_averaged_gauss ( 10, a21 );
+
+  auto row = [&] ( string name, auto g, double exact )
+  {
+    kronrod_result<double> r1 = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-10, k21 );
+    kronrod_result<double> r2 = kronrod_integrate ( g, 0.0, 1.0, 0.0, 1.0E-10, a21 );
+    cout << "  " << setw(11) << left << name << right
+         << "  " << "Kronrod "
+         << "  " << setw(11) << r1.evaluations
+         << "  " << setw(10) << fabs ( r1.result - exact )
+         << "  " << setw(10) << r1.error << "\n";
+    cout << "  " << setw(11) << " "
+         << "  " << "averaged"
+         << "  " << setw(11) << r2.evaluations
+         << "  " << setw(10) << fabs ( r2.result - exact )
+         << "  " << setw(10) << r2.error << "\n";
+  };
+
+  row ( "exp(x)", [] ( double x ) { return exp ( x ); }, exp ( 1.0 ) - 1.0 );
+  row ( "sqrt(x)", [] ( double x ) { return sqrt ( x ); }, 2.0 / 3.0 );
+  row ( "1/(1+100x^2)", [] ( double x ) { return 1.0 / ( 1.0 + 100.0 * x * x ); },
+    atan ( 10.0 ) / 10.0 );
+
+  cout << "\n";
+  cout << "  Hermite weight, KRONROD_ESTIMATOR_FROM_RECURRENCE:\n";
+  cout << "\n";
+  cout << "     N  Rule      Degree       Max error  Smallest weight\n";
+  cout << "\n";
+
+  for ( int n = 1; n <= 8; n++ )
+  {
+    int m = ( 3 * n + 1 ) / 2 + 1;
+    vector<double> alpha ( m, 0.0 );
+    vector<double> beta ( m );
+    beta[0] = sqrt ( M_PI );
+    for ( int k = 1; k < m; k++ )
+    {
+      beta[k] = double ( k ) / 2.0;
+    }
+    kronrod_weighted_rule<double> rule;
+    int s = kronrod_estimator_from_recurrence ( n, alpha, beta, 0.0, 0.0, rule );
+    int degree = ( s == 0 ) ? 3 * n + 1 : 2 * n + 1;
+    double emax = 0.0;
+    for ( int k = 0; k <= degree; k += 2 )
+    {
+      kronrod_interval<double> q;
+      auto g = [k] ( double x ) { return pow ( x, k ); };
+      q = kronrod_qk_weighted ( rule, g );
+      emax = max ( emax, fabs ( q.result - tgamma ( 0.5 * k + 0.5 ) ) / tgamma ( 0.5 * k + 0.5 ) );
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(8) << left << ( ( s == 0 ) ? "Kronrod" : "averaged" ) << right
+         << "  " << setw(6) << degree
+         << "  " << setw(14) << emax
+         << "  " << setw(15) << *min_element ( rule.w1.begin ( ), rule.w1.end ( ) ) << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test24 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST24 checks the rules compiled in by KRONROD_TABLES.
+//
+//  Discussion:
+//
+//    For each table, the checksum is recomputed, KRONROD_RULE<double>
+//    must return the table, and the table is compared with the rule
+//    KRONROD generates in double, in units in the last place.  The
+//    abscissas agree to an ulp or so, but the outermost weights computed
+//    in double are off by thousands of ulps by N = 30.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license. 
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  cout << "\n";
+  cout << "TEST24\n";
+  cout << "  KRONROD_TABLES compiles rules in double into the program.\n";
+
+#ifdef KRONROD_HAVE_TABLES
+  cout << "\n";
+  cout << "     N  Checksum  From table  Max ulps from KRONROD<double>\n";
+  cout << "\n";
+
+  for ( const kronrod_table& table : kronrod_tables )
+  {
+    int n = table.n;
+    bool sum = ( kronrod_table_checksum ( n, table.x, table.w1, table.w2 ) == table.checksum );
+    kronrod_rule<double> rule ( n );
+    auto [ x, w1, w2 ] = kronrod<double> ( n );
+    bool same = true;
+    double ulps = 0.0;
+    for ( int i = 0; i <= n; i++ )
+    {
+      same = same && rule.x[i] == table.x[i] && rule.w1[i] == table.w1[i]
+        && rule.w2[i] == table.w2[i];
+      double t[3] = { table.x[i], table.w1[i], table.w2[i] };
+      double g[3] = { x[i], w1[i], w2[i] };
+      for ( int k = 0; k < 3; k++ )
+      {
+        if ( t[k] != 0.0 )
+        {
+          ulps = max ( ulps, fabs ( g[k] - t[k] ) / ( nextafter ( fabs ( t[k] ), INFINITY ) - fabs ( t[k] ) ) );
+        }
+      }
+    }
+    cout << "  " << setw(4) << n
+         << "  " << setw(8) << ( sum ? "ok" : "BAD" )
+         << "  " << setw(10) << ( same ? "yes" : "no" )
+         << "  " << setw(29) << ulps << "\n";
+  }
+#else
+  cout << "\n";
+  cout << "  Not built with KRONROD_HAVE_TABLES.\n";
+#endif
+
+  return;
+}
+//****************************************************************************80
+
 double f ( double x )
 
 //****************************************************************************80
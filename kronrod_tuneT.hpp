@@ -0,0 +1,310 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <string>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+
+#include "kronrod_integrateT.hpp"
+
+enum class kronrod_strategy { global, adaptive };
+
+struct kronrod_tuning
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TUNING is a rule order and strategy measured by KRONROD_TUNE.
+//
+//  Discussion:
+//
+//    STRATEGY is GLOBAL if the rule of order N reached the tolerance on
+//    [A,B] itself, and ADAPTIVE if the interval had to be bisected.
+//    EVALUATIONS and SECONDS are what the sample integrand took.
+//    CONVERGED is false if the limit on the subintervals was reached.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  int n = 0;
+  kronrod_strategy strategy = kronrod_strategy::global;
+  int evaluations = 0;
+  double seconds = 0.0;
+  bool converged = false;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_tuning kronrod_tune ( Function f, FloatingPoint a, FloatingPoint b,
+  FloatingPoint epsabs, FloatingPoint epsrel,
+  kronrod_rule_cache<FloatingPoint>& cache, std::vector<kronrod_tuning>& trials,
+  const std::vector<int>& orders = { 1, 2, 3, 5, 7, 10, 15, 21, 31, 63, 127, 255 },
+  int reps = 5, int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TUNE finds the cheapest rule order for a sample integrand.
+//
+//  Discussion:
+//
+//    Each order in ORDERS is tried in turn with KRONROD_INTEGRATE, taking
+//    the rules from CACHE, so that their generation is not timed.  The
+//    time of a trial is the least of REPS runs.
+//
+//    A high order that reaches the tolerance without bisecting is the
+//    global strategy, TEST03 done properly; a low order that bisects is
+//    the adaptive one.  Once an order reaches the tolerance globally, the
+//    higher orders can only cost more, and the sweep stops.
+//
+//    The recommendation is the converged trial that took the least time,
+//    or, if none converged, the one with the fewest evaluations.  It
+//    depends on the machine and on the cost of F, so it is worth storing
+//    with KRONROD_TUNING_TABLE and applying with KRONROD_INTEGRATE_TUNED
+//    to the other integrands of the same kind.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the sample integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input/output, kronrod_rule_cache<FloatingPoint>& CACHE, the rules.
+//
+//    Output, std::vector<kronrod_tuning>& TRIALS, one entry per order tried.
+//
+//    Input, std::vector<int> ORDERS, the orders to try, in increasing order.
+//
+//    Input, int REPS, the number of timed runs per order.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_tuning KRONROD_TUNE, the recommended order and strategy.
+//    If ORDERS is empty, no trial is made, and the result has N = 0 and
+//    CONVERGED false.
+//
+{
+  trials.clear ( );
+
+  if ( orders.empty ( ) )
+  {
+    return kronrod_tuning ( );
+  }
+
+  for ( int n : orders )
+  {
+    const kronrod_rule<FloatingPoint>& rule = cache.get ( n );
+    kronrod_result<FloatingPoint> r;
+    double seconds = 0.0;
+
+    for ( int k = 0; k < std::max ( reps, 1 ); k++ )
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ( );
+      r = kronrod_integrate ( f, a, b, epsabs, epsrel, rule, limit );
+      double t = std::chrono::duration<double> ( std::chrono::steady_clock::now ( ) - start ).count ( );
+      seconds = ( k == 0 ) ? t : std::min ( seconds, t );
+    }
+
+    kronrod_tuning trial;
+    trial.n = n;
+    trial.strategy = ( r.intervals == 1 ) ? kronrod_strategy::global
+      : kronrod_strategy::adaptive;
+    trial.evaluations = r.evaluations;
+    trial.seconds = seconds;
+    trial.converged = ( r.ier == 0 );
+    trials.push_back ( trial );
+
+    if ( trial.converged && trial.strategy == kronrod_strategy::global )
+    {
+      break;
+    }
+  }
+
+  kronrod_tuning best = trials[0];
+  for ( const kronrod_tuning& trial : trials )
+  {
+    if ( trial.converged != best.converged )
+    {
+      if ( trial.converged )
+      {
+        best = trial;
+      }
+    }
+    else if ( trial.converged ? trial.seconds < best.seconds
+      : trial.evaluations < best.evaluations )
+    {
+      best = trial;
+    }
+  }
+
+  return best;
+}
+//****************************************************************************80
+
+class kronrod_tuning_table
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_TUNING_TABLE keeps the tuning of each class of integrand.
+//
+//  Discussion:
+//
+//    The classes are named by the caller, say "smooth" or "peak".  The
+//    names must not contain white space.
+//
+//    SAVE writes one line per class:
+//
+//      name strategy n evaluations seconds
+//
+//    with STRATEGY "global" or "adaptive", and LOAD reads such a file
+//    back, adding to or replacing the classes already in the table.
+//    Both return false if the file cannot be opened or read.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+public:
+
+  void set ( const std::string& name, const kronrod_tuning& tuning )
+  {
+    table[name] = tuning;
+  }
+
+  bool find ( const std::string& name, kronrod_tuning& tuning ) const
+  {
+    std::map<std::string, kronrod_tuning>::const_iterator p = table.find ( name );
+    if ( p == table.end ( ) )
+    {
+      return false;
+    }
+    tuning = p->second;
+    return true;
+  }
+
+  bool save ( const std::string& filename ) const
+  {
+    std::ofstream out ( filename );
+    if ( !out )
+    {
+      return false;
+    }
+    out.precision ( 6 );
+    for ( const std::pair<const std::string, kronrod_tuning>& p : table )
+    {
+      out << p.first
+          << " " << ( p.second.strategy == kronrod_strategy::global ? "global" : "adaptive" )
+          << " " << p.second.n
+          << " " << p.second.evaluations
+          << " " << p.second.seconds << "\n";
+    }
+    return bool ( out );
+  }
+
+  bool load ( const std::string& filename )
+  {
+    std::ifstream in ( filename );
+    if ( !in )
+    {
+      return false;
+    }
+    std::string name;
+    std::string strategy;
+    kronrod_tuning tuning;
+    while ( in >> name >> strategy >> tuning.n >> tuning.evaluations >> tuning.seconds )
+    {
+      if ( strategy != "global" && strategy != "adaptive" )
+      {
+        return false;
+      }
+      tuning.strategy = ( strategy == "global" ) ? kronrod_strategy::global
+        : kronrod_strategy::adaptive;
+      tuning.converged = true;
+      table[name] = tuning;
+    }
+    return in.eof ( );
+  }
+
+private:
+
+  std::map<std::string, kronrod_tuning> table;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_result<FloatingPoint> kronrod_integrate_tuned ( Function f,
+  FloatingPoint a, FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_tuning& tuning, kronrod_rule_cache<FloatingPoint>& cache,
+  int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_TUNED integrates F with the order chosen by
+//    KRONROD_TUNE.
+//
+//  Discussion:
+//
+//    Both strategies run KRONROD_INTEGRATE with the rule of order
+//    TUNING.N.  Its first step is the global rule on [A,B], so an
+//    integrand that turns out harder than the sample is bisected rather
+//    than given a wrong answer, and costs no evaluations beyond those of
+//    the adaptive strategy with that order.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the accuracy requested.
+//
+//    Input, kronrod_tuning TUNING, the order to use.
+//
+//    Input/output, kronrod_rule_cache<FloatingPoint>& CACHE, the rules.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_result<FloatingPoint> KRONROD_INTEGRATE_TUNED, the
+//    integral and error estimates.
+//
+{
+  return kronrod_integrate ( f, a, b, epsabs, epsrel, cache.get ( tuning.n ), limit );
+}
+//****************************************************************************80
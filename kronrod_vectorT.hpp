@@ -0,0 +1,412 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <type_traits>
+
+#include "kronrod_integrateT.hpp"
+
+enum class kronrod_norm
+{
+  individual,
+  l2,
+  linf
+};
+
+template <typename FloatingPoint>
+struct kronrod_vector_result
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_VECTOR_RESULT is what KRONROD_INTEGRATE_VECTOR returns.
+//
+//  Discussion:
+//
+//    RESULT and ERROR have one entry per component.  The other members
+//    are those of KRONROD_RESULT.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  std::vector<FloatingPoint> result;
+  std::vector<FloatingPoint> error;
+  int evaluations;
+  int intervals;
+  int ier;
+};
+//****************************************************************************80
+
+template <typename FloatingPoint>
+FloatingPoint kronrod_vector_norm ( kronrod_norm norm,
+  std::span<const FloatingPoint> v )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_VECTOR_NORM is the norm of V used to order the subintervals.
+//
+//  Discussion:
+//
+//    The L2 norm for KRONROD_NORM::L2, and the maximum norm otherwise.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  FloatingPoint value = FloatingPoint ( 0 );
+
+  if ( norm == kronrod_norm::l2 )
+  {
+    for ( const FloatingPoint& vk : v )
+    {
+      value = value + vk * vk;
+    }
+    value = scalar::sqrt ( value );
+  }
+  else
+  {
+    for ( const FloatingPoint& vk : v )
+    {
+      value = std::max ( value, FloatingPoint ( scalar::abs ( vk ) ) );
+    }
+  }
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint>
+bool kronrod_vector_converged ( kronrod_norm norm, FloatingPoint epsabs,
+  FloatingPoint epsrel, std::span<const FloatingPoint> result,
+  std::span<const FloatingPoint> error )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_VECTOR_CONVERGED tests the error of a vector integral.
+//
+//  Discussion:
+//
+//    For KRONROD_NORM::INDIVIDUAL, every component must satisfy
+//    ERROR[K] <= max ( EPSABS, EPSREL * |RESULT[K]| ).  Otherwise the
+//    norm of ERROR must be at most max ( EPSABS, EPSREL * norm of RESULT ).
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  typedef kronrod_scalar<FloatingPoint> scalar;
+
+  if ( norm == kronrod_norm::individual )
+  {
+    for ( std::size_t k = 0; k < result.size ( ); k++ )
+    {
+      if ( std::max ( epsabs, FloatingPoint ( epsrel * scalar::abs ( result[k] ) ) ) < error[k] )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return kronrod_vector_norm ( norm, error )
+    <= std::max ( epsabs, FloatingPoint ( epsrel * kronrod_vector_norm ( norm, result ) ) );
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_vector_result<FloatingPoint> kronrod_integrate_vector ( Function f,
+  int fdim, FloatingPoint a, FloatingPoint b, FloatingPoint epsabs,
+  FloatingPoint epsrel, const kronrod_rule<FloatingPoint>& rule,
+  kronrod_norm norm = kronrod_norm::individual, int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_VECTOR integrates a vector valued F over [A,B].
+//
+//  Discussion:
+//
+//    F is called as F ( X, FX ), and sets the FDIM components FX[K] of
+//    the integrand at X.  All the components share one subdivision, so
+//    that work common to them is done once per abscissa.
+//
+//    Each component gets the estimates of KRONROD_QK.  The subintervals
+//    are bisected as in KRONROD_INTEGRATE until KRONROD_VECTOR_CONVERGED
+//    holds for the whole interval.  For KRONROD_NORM::L2 and LINF they are
+//    ordered by the norm of their error vectors.  For INDIVIDUAL they are
+//    ordered by the largest ERROR[K] / max ( EPSABS, EPSREL * |RESULT[K]| ),
+//    with RESULT the estimate of the whole integral when the subinterval
+//    was made, so that the work goes to the components that have not yet
+//    met their own tolerance, however small they are.
+//
+//    IER is 0 if the requested accuracy was reached, and 1 if the number
+//    of subintervals reached LIMIT.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+//  Parameters:
+//
+//    Input, Function F, the integrand.
+//
+//    Input, int FDIM, the number of components.
+//
+//    Input, FloatingPoint A, B, the interval.
+//
+//    Input, FloatingPoint EPSABS, EPSREL, the absolute and relative
+//    accuracy requested.
+//
+//    Input, kronrod_rule<FloatingPoint> RULE, the rule to apply.
+//
+//    Input, kronrod_norm NORM, the error criterion.
+//
+//    Input, int LIMIT, the maximum number of subintervals.
+//
+//    Output, kronrod_vector_result<FloatingPoint> KRONROD_INTEGRATE_VECTOR,
+//    the integral and error estimates.
+//
+{
+//
+//  The subintervals on the heap refer to their estimates by SLOT, in
+//  RESULT[SLOT*FDIM+K] and ERROR[SLOT*FDIM+K].
+//
+  struct node
+  {
+    FloatingPoint a;
+    FloatingPoint b;
+    FloatingPoint error;
+    int slot;
+  };
+
+  auto worse = [] ( const node& p, const node& q )
+  {
+    if ( p.error != q.error )
+    {
+      return p.error < q.error;
+    }
+    return q.a < p.a;
+  };
+
+  int n = rule.n;
+  int m = 2 * n + 1;
+  std::vector<node> heap;
+  std::vector<FloatingPoint> result;
+  std::vector<FloatingPoint> error;
+  std::vector<FloatingPoint> fx ( m * fdim );
+  std::vector<FloatingPoint> fk ( m );
+  std::vector<FloatingPoint> pr ( fdim );
+  std::vector<FloatingPoint> pe ( fdim );
+  std::vector<kronrod_sum<FloatingPoint>> total ( fdim );
+  kronrod_vector_result<FloatingPoint> value;
+
+//
+//  The heap key of SLOT.  A tolerance of 0 is taken as the smallest
+//  positive number, so that such components still come first.
+//
+  auto key = [&] ( int slot )
+  {
+    typedef kronrod_scalar<FloatingPoint> scalar;
+
+    std::span<const FloatingPoint> e ( error.data ( ) + slot * fdim, fdim );
+
+    if ( norm != kronrod_norm::individual )
+    {
+      return kronrod_vector_norm ( norm, e );
+    }
+
+    FloatingPoint worst = FloatingPoint ( 0 );
+    for ( int k = 0; k < fdim; k++ )
+    {
+      FloatingPoint tol = std::max ( epsabs,
+        FloatingPoint ( epsrel * scalar::abs ( value.result[k] ) ) );
+      tol = std::max ( tol, FloatingPoint ( scalar::min ( ) ) );
+      worst = std::max ( worst, FloatingPoint ( e[k] / tol ) );
+    }
+    return worst;
+  };
+
+  auto apply = [&] ( FloatingPoint a, FloatingPoint b, int slot )
+  {
+    FloatingPoint center = ( a + b ) / FloatingPoint ( 2 );
+    FloatingPoint half = ( b - a ) / FloatingPoint ( 2 );
+
+    f ( center, std::span<FloatingPoint> ( fx.data ( ) + 2 * n * fdim, fdim ) );
+    for ( int i = 0; i < n; i++ )
+    {
+      FloatingPoint dx = half * rule.x[i];
+      f ( center - dx, std::span<FloatingPoint> ( fx.data ( ) + 2 * i * fdim, fdim ) );
+      f ( center + dx, std::span<FloatingPoint> ( fx.data ( ) + ( 2 * i + 1 ) * fdim, fdim ) );
+    }
+
+    if ( int ( result.size ( ) ) < ( slot + 1 ) * fdim )
+    {
+      result.resize ( ( slot + 1 ) * fdim );
+      error.resize ( ( slot + 1 ) * fdim );
+    }
+
+    for ( int k = 0; k < fdim; k++ )
+    {
+      for ( int p = 0; p < m; p++ )
+      {
+        fk[p] = fx[p*fdim+k];
+      }
+      kronrod_interval<FloatingPoint> h = kronrod_qk_sums ( rule, fk, a, b );
+      result[slot*fdim+k] = h.result;
+      error[slot*fdim+k] = h.error;
+    }
+
+    node p;
+    p.a = a;
+    p.b = b;
+    p.error = FloatingPoint ( 0 );
+    p.slot = slot;
+    return p;
+  };
+
+  heap.push_back ( apply ( a, b, 0 ) );
+  for ( int k = 0; k < fdim; k++ )
+  {
+    total[k].add ( result[k] );
+  }
+  value.result.assign ( result.begin ( ), result.end ( ) );
+  value.error.assign ( error.begin ( ), error.end ( ) );
+  heap[0].error = key ( 0 );
+  value.evaluations = m;
+  value.intervals = 1;
+  value.ier = 0;
+
+  while ( !kronrod_vector_converged<FloatingPoint> ( norm, epsabs, epsrel,
+    value.result, value.error ) )
+  {
+    if ( limit <= value.intervals )
+    {
+      value.ier = 1;
+      break;
+    }
+
+    std::pop_heap ( heap.begin ( ), heap.end ( ), worse );
+    node p = heap.back ( );
+    heap.pop_back ( );
+//
+//  The first half reuses the slot of P, so save its estimates first.
+//
+    std::copy ( result.begin ( ) + p.slot * fdim,
+      result.begin ( ) + ( p.slot + 1 ) * fdim, pr.begin ( ) );
+    std::copy ( error.begin ( ) + p.slot * fdim,
+      error.begin ( ) + ( p.slot + 1 ) * fdim, pe.begin ( ) );
+
+    FloatingPoint mid = ( p.a + p.b ) / FloatingPoint ( 2 );
+    node h1 = apply ( p.a, mid, p.slot );
+    node h2 = apply ( mid, p.b, value.intervals );
+
+    for ( int k = 0; k < fdim; k++ )
+    {
+      total[k].add ( result[h1.slot*fdim+k] );
+      total[k].add ( result[h2.slot*fdim+k] );
+      total[k].add ( - pr[k] );
+      value.result[k] = total[k].value ( );
+      value.error[k] = value.error[k]
+        + ( ( error[h1.slot*fdim+k] + error[h2.slot*fdim+k] ) - pe[k] );
+    }
+
+    h1.error = key ( h1.slot );
+    h2.error = key ( h2.slot );
+    heap.push_back ( h1 );
+    std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+    heap.push_back ( h2 );
+    std::push_heap ( heap.begin ( ), heap.end ( ), worse );
+
+    value.evaluations = value.evaluations + 2 * m;
+    value.intervals = value.intervals + 1;
+  }
+//
+//  Sum the final estimates again, to remove the drift of the updates.
+//
+  std::sort ( heap.begin ( ), heap.end ( ),
+    [] ( const node& p, const node& q ) { return p.a < q.a; } );
+  std::vector<kronrod_sum<FloatingPoint>> sum ( fdim );
+  std::fill ( value.error.begin ( ), value.error.end ( ), FloatingPoint ( 0 ) );
+  for ( const node& p : heap )
+  {
+    for ( int k = 0; k < fdim; k++ )
+    {
+      sum[k].add ( result[p.slot*fdim+k] );
+      value.error[k] = value.error[k] + error[p.slot*fdim+k];
+    }
+  }
+  for ( int k = 0; k < fdim; k++ )
+  {
+    value.result[k] = sum[k].value ( );
+  }
+
+  return value;
+}
+//****************************************************************************80
+
+template <typename FloatingPoint, typename Function>
+kronrod_vector_result<FloatingPoint> kronrod_integrate_vector ( Function f,
+  FloatingPoint a, FloatingPoint b, FloatingPoint epsabs, FloatingPoint epsrel,
+  const kronrod_rule<FloatingPoint>& rule,
+  kronrod_norm norm = kronrod_norm::individual, int limit = 1000 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    KRONROD_INTEGRATE_VECTOR integrates an F that returns a std::array.
+//
+//  Discussion:
+//
+//    F is called as F ( X ), and returns a std::array<FloatingPoint,FDIM>.
+//
+//  Modified:
+//
+//    18 October 2026
+//
+//  Author:
+//
+//    Okwuchukwu Nwobi
+//
+{
+  typedef std::invoke_result_t<Function&, FloatingPoint> array;
+  constexpr int fdim = int ( std::tuple_size<array>::value );
+
+  auto g = [&] ( const FloatingPoint& x, std::span<FloatingPoint> fx )
+  {
+    array v = f ( x );
+    std::copy ( v.begin ( ), v.end ( ), fx.begin ( ) );
+  };
+
+  return kronrod_integrate_vector ( g, fdim, a, b, epsabs, epsrel, rule, norm, limit );
+}
@@ -3,7 +3,7 @@
 #include <tuple>
 #include "kronrod.hpp"
 #include "kronrodT.hpp"
-#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
 #include <vector>
 #include <limits>
 #include <iomanip>
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <filesystem>
+#include <memory_resource>
 namespace fs = std::filesystem;
 
 int njobs = 20;
@@ -26,13 +27,15 @@ std::mutex mtx;
 std::condition_variable cv;
 
 using namespace boost::multiprecision;
-using FloatingPointType = cpp_dec_float_50;
+// Binary multiprecision is several times faster than cpp_dec_float_50 for
+// the same number of digits; any type supported by kronrod_scalar will do.
+using FloatingPointType = cpp_bin_float_50;
 
 void compute_kronrod(int nx, double tol){
 
     // compute the Kronrod abscissas and weights
     double x1[nx], w11[nx], w21[nx];
-    kronrod(nx, 10e-10, x1, w11, w21);
+    kronrod(nx, tol, x1, w11, w21);
 
 
     std::ofstream myfile;
@@ -56,10 +59,13 @@ void compute_kronrod(int nx, double tol){
 }
 
 template <typename FloatingPointType>
-void compute_kronrod_mp(int n, FloatingPointType tol){
+void compute_kronrod_mp(int n, FloatingPointType tol, 
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource()){
     
-    // compute the Kronrod abscissas and weights
-    auto [x, wk, wg] = kronrod<FloatingPointType>(n, tol);
+    // compute the Kronrod abscissas and weights in an arena that is 
+    // released when this order is written out
+    std::pmr::monotonic_buffer_resource arena(resource);
+    auto [x, wk, wg] = kronrod<FloatingPointType>(n, tol, &arena);
 
     std::ofstream myfile;
     std::string filename = "../kronrod/"+std::to_string(n)+"_mp.txt";
@@ -90,10 +96,13 @@ void compute_kronrod_mp(int n, FloatingPointType tol){
 template <typename FloatingPointType>
 void compute_points_mp(std::vector<int> Ns, FloatingPointType tol){
 
+    // each thread recycles its own memory, so the threads do not
+    // contend on the global allocator
+    std::pmr::unsynchronized_pool_resource pool;
     
     for (int n : Ns){
         std::cout << "Computing Kronrod points for n = " << n << std::endl;
-        compute_kronrod_mp<FloatingPointType>(n, tol);
+        compute_kronrod_mp<FloatingPointType>(n, tol, &pool);
     }
 
     RemainingThreads--;
@@ -109,7 +118,7 @@ int main() {
     try{
 
         std::cout << std::numeric_limits<FloatingPointType>::epsilon() << std::endl;
-        FloatingPointType eps(10e-20);
+        FloatingPointType eps = kronrod_eps<FloatingPointType>();
         const int n = 2701;
         // auto [x, w1, w2] = kronrod<FloatingPointType>(n, eps);
 